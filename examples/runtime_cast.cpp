@@ -84,6 +84,22 @@ int main() {
         std::cout << "Error: Expected ap to point to a B" << '\n';
     }
 
+/*`
+    Call sites that see objects of the same dynamic type over and over again could remember the result
+    of the cast in a boost::typeindex::runtime_cast_cache. Repeated casts of objects of the same dynamic
+    type then do not search through the bases.
+*/
+    static boost::typeindex::runtime_cast_cache<D> cache;
+    for (int i = 0; i < 2; ++i) {
+        if(D* dp = boost::typeindex::runtime_cast<D*>(ap, cache)) {
+            std::cout << "Yes, the cached cast finds D: "
+                      << ap << "->" << dp << '\n';
+        }
+        else {
+            std::cout << "Error: Expected ap to point to a D" << '\n';
+        }
+    }
+
     return 0;
 }
 
@@ -189,6 +189,56 @@ using type_info = type_index::type_info_t;
 /// \endcode
 #define BOOST_TYPE_INDEX_REGISTER_CLASS nothing-or-some-virtual-functions
 
+/// \def BOOST_TYPE_INDEX_CTTI_INTERN_NAMES
+/// BOOST_TYPE_INDEX_CTTI_INTERN_NAMES is an opt-in macro for boost::typeindex::ctti_type_index.
+///
+/// If it is defined, then on first use in each module every type name is registered in a process
+/// wide registry and all the boost::typeindex::ctti_type_index instances constructed at runtime point
+/// to a single canonical copy of the name. This makes comparison of equal types from different
+/// shared libraries (for example plugins built with hidden visibility) a single pointer comparison.
+///
+/// Has effect only in C++14 and above on compilers that are able to detect constant evaluation.
+/// Instances constructed at compile time are not interned, but still compare correctly with the interned ones.
+/// Modules built with and without the macro may be safely mixed.
+#define BOOST_TYPE_INDEX_CTTI_INTERN_NAMES
+
+/// \def BOOST_TYPE_INDEX_BUILTIN_DEMANGLE
+/// BOOST_TYPE_INDEX_BUILTIN_DEMANGLE is an opt-in macro for boost::typeindex::stl_type_index.
+///
+/// If it is defined, then on platforms with Itanium C++ ABI boost::typeindex::stl_type_index::pretty_name() demangles
+/// the type names with a builtin demangler that works in a buffer on the stack and does not allocate memory, instead of
+/// abi::__cxa_demangle. The builtin demangler supports class types, their templates and cv-qualified pointers and references
+/// to them; other names are passed to abi::__cxa_demangle. Output is the same as of abi::__cxa_demangle from libstdc++.
+///
+/// Modules built with and without the macro may be safely mixed.
+#define BOOST_TYPE_INDEX_BUILTIN_DEMANGLE
+
+/// \def BOOST_TYPE_INDEX_RUNTIME_CAST_MEMOIZE
+/// BOOST_TYPE_INDEX_RUNTIME_CAST_MEMOIZE is an opt-in macro for boost::typeindex::runtime_cast.
+///
+/// If it is defined, then the results of the casts are remembered in a process wide table for each
+/// target type, keyed by the virtual table of the source object. Later casts of objects with the same
+/// dynamic type from any place of the program, including the casts that found nothing, do not search
+/// through the bases. Lookups in the table do not lock.
+///
+/// The table is used only on platforms with the Itanium C++ ABI (GCC, Clang except clang-cl), where the
+/// virtual table pointer is at the start of each polymorphic object. On other platforms the macro has no effect.
+///
+/// Modules built with and without the macro may be safely mixed.
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_MEMOIZE
+
+/// \def BOOST_TYPE_INDEX_RUNTIME_CAST_STATS
+/// BOOST_TYPE_INDEX_RUNTIME_CAST_STATS is an opt-in macro for boost::typeindex::runtime_cast instrumentation.
+///
+/// If it is defined, then each boost::typeindex::runtime_cast call increments the per thread counters of calls,
+/// successes, failures and of checked ancestors for the combination of the static source type, the target type
+/// and the dynamic type of the object. The counters are reported by boost::typeindex::runtime_cast_stats_snapshot().
+/// If the macro is not defined, the instrumentation is not compiled at all.
+///
+/// Adds a virtual function to the classes with BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST, so all the sources of
+/// the program must be compiled with the same value of the macro.
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_STATS
+
 /// \def BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY
 /// BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY is a helper macro that must be defined if mixing
 /// RTTI on/off modules. See
@@ -0,0 +1,220 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_CONCURRENT_TYPE_MAP_HPP
+#define BOOST_TYPE_INDEX_CONCURRENT_TYPE_MAP_HPP
+
+/// \file concurrent_type_map.hpp
+/// \brief Contains boost::typeindex::concurrent_type_map class - a hash map with
+/// boost::typeindex::type_index keys for read mostly multithreaded workloads.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/detail/hash_mix.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \class concurrent_type_map
+/// Hash map with boost::typeindex::type_index keys that could be read and extended from multiple threads
+/// at the same time. Designed for tables that are read on every request and are rarely extended,
+/// for example handlers that are added on loading of plugins.
+///
+/// Lookups are wait-free: they do not lock, do not retry and only do atomic loads. Insertions are
+/// serialized by a mutex. Elements are never removed, so the references to the mapped values stay
+/// valid till the destruction of the container. The hash_code() of each key is computed once on insertion
+/// and is stored in the container.
+///
+/// When the container grows the old array of slots may still be used by concurrent readers, so it is
+/// retired and freed only on destruction of the container. Arrays grow twice on each rehashing,
+/// so the retired arrays take less memory than the current one.
+///
+/// \b Example:
+/// \code
+/// boost::typeindex::concurrent_type_map<handler_fn> handlers;
+///
+/// // Plugin loading thread
+/// handlers.emplace(boost::typeindex::type_id<ping>(), &on_ping);
+///
+/// // Worker threads
+/// if (const handler_fn* h = handlers.find(boost::typeindex::type_id_runtime(message))) {
+///     (*h)(message);
+/// }
+/// \endcode
+///
+/// \tparam V Type of the mapped values. Concurrent modifications of the mapped values are not synchronized
+/// by the container.
+template <class V>
+class concurrent_type_map {
+public:
+    using key_type = type_index;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    concurrent_type_map()
+        : current_(nullptr)
+        , size_(0)
+    {
+        slots_.emplace_back(new slots_type(16));
+        current_.store(slots_.back().get(), std::memory_order_release);
+    }
+
+    concurrent_type_map(const concurrent_type_map&) = delete;
+    concurrent_type_map& operator=(const concurrent_type_map&) = delete;
+
+    /// \return Count of elements. May be outdated if there are concurrent insertions.
+    size_type size() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const noexcept {
+        return !size();
+    }
+
+    /// Wait-free lookup.
+    /// \return Pointer to the mapped value or nullptr if there is no such key in the container.
+    mapped_type* find(const key_type& key) noexcept {
+        entry_type* e = find_entry(*current_.load(std::memory_order_acquire), key, detail::hash_mix(key.hash_code()));
+        return e ? &e->value_ : nullptr;
+    }
+
+    /// Wait-free lookup.
+    /// \return Pointer to the mapped value or nullptr if there is no such key in the container.
+    const mapped_type* find(const key_type& key) const noexcept {
+        return const_cast<concurrent_type_map&>(*this).find(key);
+    }
+
+    bool contains(const key_type& key) const noexcept {
+        return !!find(key);
+    }
+
+    /// Inserts a value constructed from `args` if there is no such key in the container.
+    /// \return Pair of a reference to the mapped value for the key and a flag that is true if the insertion took place.
+    /// \throw Nothing except std::bad_alloc and the exceptions of the mapped_type constructor.
+    template <class... Args>
+    std::pair<mapped_type&, bool> emplace(const key_type& key, Args&&... args) {
+        const std::size_t hash = detail::hash_mix(key.hash_code());
+        if (entry_type* e = find_entry(*current_.load(std::memory_order_acquire), key, hash)) {
+            return std::pair<mapped_type&, bool>(e->value_, false);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots_type* slots = current_.load(std::memory_order_relaxed);
+        if (entry_type* e = find_entry(*slots, key, hash)) {
+            return std::pair<mapped_type&, bool>(e->value_, false);
+        }
+
+        const std::size_t size = entries_.size();
+        entries_.reserve(size + 1);
+        if ((size + 1) * 2 > slots->size_) {
+            slots = grow(slots->size_ * 2);
+        }
+
+        entries_.emplace_back(new entry_type(key, hash, std::forward<Args>(args)...));
+        place(*slots, entries_.back().get());
+        size_.store(size + 1, std::memory_order_release);
+        return std::pair<mapped_type&, bool>(entries_.back()->value_, true);
+    }
+
+private:
+    struct entry_type {
+        template <class... Args>
+        entry_type(const key_type& key, std::size_t hash, Args&&... args)
+            : key_(key)
+            , hash_(hash)
+            , value_(std::forward<Args>(args)...)
+        {}
+
+        const type_index key_;
+        const std::size_t hash_;  // mixed hash_code() of the key
+        mapped_type value_;
+    };
+
+    struct slots_type {
+        explicit slots_type(std::size_t size)
+            : size_(size)
+            , data_(new std::atomic<entry_type*>[size])
+        {
+            for (std::size_t i = 0; i < size_; ++i) {
+                data_[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        const std::size_t size_;  // always a power of 2
+        const std::unique_ptr<std::atomic<entry_type*>[]> data_;
+    };
+
+    // Table is never more than half full, so the probing always stops at an empty slot
+    static entry_type* find_entry(const slots_type& slots, const key_type& key, std::size_t hash) noexcept {
+        const std::size_t mask = slots.size_ - 1;
+        for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+            entry_type* e = slots.data_[i].load(std::memory_order_acquire);
+            if (!e) {
+                return nullptr;
+            }
+            if (e->hash_ == hash && e->key_ == key) {
+                return e;
+            }
+        }
+    }
+
+    static void place(slots_type& slots, entry_type* e) noexcept {
+        const std::size_t mask = slots.size_ - 1;
+        std::size_t i = e->hash_ & mask;
+        while (slots.data_[i].load(std::memory_order_relaxed)) {
+            i = (i + 1) & mask;
+        }
+        slots.data_[i].store(e, std::memory_order_release);
+    }
+
+    slots_type* grow(std::size_t new_size) {
+        slots_.reserve(slots_.size() + 1);
+        std::unique_ptr<slots_type> slots(new slots_type(new_size));
+        for (const auto& e : entries_) {
+            place(*slots, e.get());
+        }
+
+        slots_.push_back(std::move(slots));
+        current_.store(slots_.back().get(), std::memory_order_release);
+        return slots_.back().get();
+    }
+
+    std::atomic<slots_type*> current_;
+    std::atomic<std::size_t> size_;
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<entry_type> > entries_;
+    std::vector<std::unique_ptr<slots_type> > slots_;  // current and retired arrays of slots
+};
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_CONCURRENT_TYPE_MAP_HPP
@@ -27,6 +27,10 @@
 #include <boost/type_index/type_index_facade.hpp>
 #include <boost/type_index/detail/compile_time_type_info.hpp>
 
+#if defined(BOOST_TYPE_INDEX_CTTI_INTERN_NAMES)
+#include <boost/type_index/detail/ctti_intern.hpp>
+#endif
+
 #if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
 #ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
 #include <cstring>
@@ -40,6 +44,19 @@
 # pragma once
 #endif
 
+/// @cond
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && defined(BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED)
+#define BOOST_TYPE_INDEX_DETAIL_CTTI_HASH_CONSTEXPR constexpr
+#else
+#define BOOST_TYPE_INDEX_DETAIL_CTTI_HASH_CONSTEXPR
+#endif
+
+#if defined(BOOST_TYPE_INDEX_CTTI_INTERN_NAMES) && !defined(BOOST_NO_CXX14_CONSTEXPR) \
+    && defined(BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED)
+#define BOOST_TYPE_INDEX_DETAIL_CTTI_INTERNING
+#endif
+/// @endcond
+
 namespace boost { namespace typeindex {
 
 namespace detail {
@@ -75,6 +92,16 @@ public:
 };
 BOOST_TYPE_INDEX_END_MODULE_EXPORT
 
+template <class T>
+BOOST_CXX14_CONSTEXPR inline const char* ctti_type_name() noexcept {
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_INTERNING)
+    if (!BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED()) {
+        return boost::typeindex::detail::ctti_interned_name<T>();
+    }
+#endif
+    return boost::typeindex::detail::postprocessed_name<T>();
+}
+
 } // namespace detail
 
 BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
@@ -92,7 +119,7 @@ inline const detail::ctti_data& ctti_construct() noexcept {
     // value.
     //
     // Alignments are checked in `type_index_test_ctti_alignment.cpp` test.
-    return *reinterpret_cast<const detail::ctti_data*>(boost::typeindex::detail::postprocessed_name<T>());
+    return *reinterpret_cast<const detail::ctti_data*>(boost::typeindex::detail::ctti_type_name<T>());
 }
 
 /// \class ctti_type_index
@@ -104,9 +131,15 @@ inline const detail::ctti_data& ctti_construct() noexcept {
 ///     * default constructor
 ///     * copy constructors and assignment operations
 ///     * class methods: name(), before(const ctti_type_index& rhs), equal(const ctti_type_index& rhs)
+///     * class method hash_code(), if the compiler is able to detect constant evaluation
 ///     * static methods type_id<T>(), type_id_with_cvr<T>()
 ///     * comparison operators
 ///
+/// Starting from C++14 the length and the hash of a type name are computed at compile time.
+/// hash_code() and pretty_name() do not scan the name, equal() rejects names of different
+/// length without comparing characters, and equal() and before() compare names of known length
+/// with std::memcmp rather than scanning for the terminating zero.
+///
 /// Moreover, starting from C++14 the name() function always outputs the pretty_name() of a
 /// type. For example the following static assert holds:
 /// \code
@@ -116,6 +149,10 @@ inline const detail::ctti_data& ctti_construct() noexcept {
 /// );
 /// \endcode
 ///
+/// If BOOST_TYPE_INDEX_CTTI_INTERN_NAMES is defined, then instances that are constructed at runtime
+/// point to a single process wide copy of each type name. Comparison of such instances is a single
+/// pointer comparison even if the names were duplicated across shared libraries.
+///
 /// This class produces slightly longer type names in C++11 than stl_type_index, see
 /// "Code Bloat" fore more info.
 class ctti_type_index: public type_index_facade<ctti_type_index, detail::ctti_data> {
@@ -131,7 +168,7 @@ public:
     using type_info_t = detail::ctti_data;
 
     BOOST_CXX14_CONSTEXPR inline ctti_type_index() noexcept
-        : data_(boost::typeindex::detail::postprocessed_name<void>())
+        : data_(boost::typeindex::detail::ctti_type_name<void>())
     {}
 
     inline ctti_type_index(const type_info_t& data) noexcept
@@ -142,7 +179,7 @@ public:
     BOOST_CXX14_CONSTEXPR inline const char* raw_name() const noexcept;
     BOOST_CXX14_CONSTEXPR inline const char* name() const noexcept;
     inline std::string  pretty_name() const;
-    inline std::size_t  hash_code() const noexcept;
+    BOOST_TYPE_INDEX_DETAIL_CTTI_HASH_CONSTEXPR inline std::size_t hash_code() const noexcept;
 
     BOOST_CXX14_CONSTEXPR inline bool equal(const ctti_type_index& rhs) const noexcept;
     BOOST_CXX14_CONSTEXPR inline bool before(const ctti_type_index& rhs) const noexcept;
@@ -168,11 +205,23 @@ inline const ctti_type_index::type_info_t& ctti_type_index::type_info() const no
 BOOST_CXX14_CONSTEXPR inline bool ctti_type_index::equal(const ctti_type_index& rhs) const noexcept {
     const char* const left = raw_name();
     const char* const right = rhs.raw_name();
-#ifdef __cpp_lib_is_constant_evaluated
-    if (!std::is_constant_evaluated()) {
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+    if (left == right) {
+        return true;
+    }
+#elif defined(BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED)
+    if (!BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED()) {
         if (left == right) {
             return true;
         }
+
+        const detail::ctti_name_header& left_header = detail::ctti_name_header_of(left);
+        const detail::ctti_name_header& right_header = detail::ctti_name_header_of(right);
+        if (left_header.length_ != right_header.length_ || left_header.hash_ != right_header.hash_) {
+            return false;
+        }
+
+        return !std::memcmp(left, right, left_header.length_);
     }
 #endif
     return !boost::typeindex::detail::constexpr_strcmp(left, right);
@@ -181,11 +230,20 @@ BOOST_CXX14_CONSTEXPR inline bool ctti_type_index::equal(const ctti_type_index&
 BOOST_CXX14_CONSTEXPR inline bool ctti_type_index::before(const ctti_type_index& rhs) const noexcept {
     const char* const left = raw_name();
     const char* const right = rhs.raw_name();
-#ifdef __cpp_lib_is_constant_evaluated
-    if (!std::is_constant_evaluated()) {
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+    if (left == right) {
+        return false;
+    }
+#elif defined(BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED)
+    if (!BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED()) {
         if (left == right) {
             return false;
         }
+
+        // Comparing the terminating '\0' of the shorter name orders a prefix before the longer name
+        const std::size_t left_length = detail::ctti_name_header_of(left).length_;
+        const std::size_t right_length = detail::ctti_name_header_of(right).length_;
+        return std::memcmp(left, right, (left_length < right_length ? left_length : right_length) + 1) < 0;
     }
 #endif
     return boost::typeindex::detail::constexpr_strcmp(left, right) < 0;
@@ -196,14 +254,14 @@ template <class T>
 BOOST_CXX14_CONSTEXPR inline ctti_type_index ctti_type_index::type_id() noexcept {
     using no_ref_t = typename std::remove_reference<T>::type;
     using no_cvr_t = typename std::remove_cv<no_ref_t>::type;
-    return ctti_type_index(boost::typeindex::detail::postprocessed_name<no_cvr_t>());
+    return ctti_type_index(boost::typeindex::detail::ctti_type_name<no_cvr_t>());
 }
 
 
 
 template <class T>
 BOOST_CXX14_CONSTEXPR inline ctti_type_index ctti_type_index::type_id_with_cvr() noexcept {
-    return ctti_type_index(boost::typeindex::detail::postprocessed_name<T>());
+    return ctti_type_index(boost::typeindex::detail::ctti_type_name<T>());
 }
 
 
@@ -226,7 +284,7 @@ inline std::size_t ctti_type_index::get_raw_name_length() const noexcept {
 #if defined(BOOST_NO_CXX14_CONSTEXPR)
     return detail::constexpr_significant_part_length(raw_name());
 #else
-    return std::strlen(raw_name());
+    return detail::ctti_name_header_of(raw_name()).length_;
 #endif
 }
 
@@ -237,8 +295,17 @@ inline std::string ctti_type_index::pretty_name() const {
 }
 
 
-inline std::size_t ctti_type_index::hash_code() const noexcept {
-    return boost::hash_range(raw_name(), raw_name() + get_raw_name_length());
+BOOST_TYPE_INDEX_DETAIL_CTTI_HASH_CONSTEXPR inline std::size_t ctti_type_index::hash_code() const noexcept {
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+#if defined(BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED)
+    if (BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED()) {
+        return detail::constexpr_hash(raw_name(), detail::constexpr_strlen(raw_name()));
+    }
+#endif
+    return detail::ctti_name_header_of(raw_name()).hash_;
+#else
+    return detail::constexpr_hash(raw_name(), get_raw_name_length());
+#endif
 }
 
 }} // namespace boost::typeindex
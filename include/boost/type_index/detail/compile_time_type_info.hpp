@@ -39,6 +39,16 @@
 #define BOOST_TYPE_INDEX_DETAIL_BUILTIN_STRCMP(str1, str2) __builtin_strcmp(str1, str2)
 #endif
 
+#if defined(__cpp_lib_is_constant_evaluated)
+#define BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif defined(__GNUC__) && (__GNUC__ >= 9)
+#define BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
 /// @endcond
 
 
@@ -212,6 +222,34 @@ constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(0, 0, ""); }
 #endif
     }
 
+    BOOST_CXX14_CONSTEXPR inline std::size_t constexpr_strlen(const char* str) noexcept {
+        std::size_t length = 0;
+        while (str[length]) {
+            ++length;
+        }
+
+        return length;
+    }
+
+    // FNV-1a. Used instead of boost::hash_range because it must be usable at compile time.
+    BOOST_CXX14_CONSTEXPR inline std::size_t constexpr_hash(const char* str, std::size_t length) noexcept {
+        std::size_t hash = (sizeof(std::size_t) > 4
+            ? static_cast<std::size_t>(14695981039346656037ULL)
+            : static_cast<std::size_t>(2166136261UL)
+        );
+        const std::size_t prime = (sizeof(std::size_t) > 4
+            ? static_cast<std::size_t>(1099511628211ULL)
+            : static_cast<std::size_t>(16777619UL)
+        );
+
+        for (std::size_t i = 0; i < length; ++i) {
+            hash ^= static_cast<unsigned char>(str[i]);
+            hash *= prime;
+        }
+
+        return hash;
+    }
+
     template <unsigned int ArrayLength>
     BOOST_CXX14_CONSTEXPR inline const char* after_substrig(const char* begin) noexcept {
         constexpr auto skip_value = detail::skip();  // to have the same `.substrig` value in code below
@@ -269,6 +307,41 @@ constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(0, 0, ""); }
 
     template <char... C>
     constexpr char cstring<C...>::data_[];
+
+    // Data that is computed at compile time and stored right before the
+    // characters of each name returned by postprocessed_name().
+    struct ctti_name_header {
+        std::size_t length_;
+        std::size_t hash_;
+    };
+
+    template <unsigned int N>
+    struct ctti_name_storage {
+        ctti_name_header header_;
+        char data_[N];
+    };
+
+    template <char... C>
+    constexpr std::size_t ctti_name_hash() noexcept {
+        constexpr char name[] = { C..., '\0' };
+        return detail::constexpr_hash(name, sizeof...(C));
+    }
+
+    template <char... C>
+    struct ctti_name {
+        static constexpr ctti_name_storage<sizeof...(C) + 1> storage_ = {
+            { sizeof...(C), detail::ctti_name_hash<C...>() },
+            { C..., '\0' }
+        };
+    };
+
+    template <char... C>
+    constexpr ctti_name_storage<sizeof...(C) + 1> ctti_name<C...>::storage_;
+
+    // `name` must be a pointer returned by postprocessed_name().
+    inline const ctti_name_header& ctti_name_header_of(const char* name) noexcept {
+        return *reinterpret_cast<const ctti_name_header*>(name - sizeof(ctti_name_header));
+    }
 #endif
 
 }}} // namespace boost::typeindex::detail
@@ -375,8 +448,8 @@ namespace boost { namespace typeindex { namespace detail {
     template <class T, unsigned int ...Indexes>
     constexpr const char* make_pretty_name(::boost::typeindex::detail::index_seq<Indexes...> ) noexcept {
         constexpr const char* name = boost::detail::ctti<T>::n();
-        using string_type = ::boost::typeindex::detail::cstring<name[Indexes]...>;
-        return string_type::data_;
+        using name_type = ::boost::typeindex::detail::ctti_name<name[Indexes]...>;
+        return name_type::storage_.data_;
     }
 
     template <class T>
@@ -0,0 +1,120 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_CTTI_INTERN_HPP
+#define BOOST_TYPE_INDEX_DETAIL_CTTI_INTERN_HPP
+
+/// \file ctti_intern.hpp
+/// \brief Contains the process wide registry of ctti names that is used if
+/// BOOST_TYPE_INDEX_CTTI_INTERN_NAMES is defined.
+/// Not intended for inclusion from user's code.
+
+#include <boost/type_index/detail/config.hpp>
+#include <boost/type_index/detail/compile_time_type_info.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <unordered_set>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+namespace boost { namespace typeindex { namespace detail {
+
+// Maps names with equal characters to a single canonical copy of the name.
+// Canonical copies have the same layout as ctti_name_storage and are never
+// freed, so they outlive the unloading of the modules that registered them.
+class ctti_intern_registry {
+public:
+    const char* intern(const char* name) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+#ifndef BOOST_NO_EXCEPTIONS
+        try {
+#endif
+            const auto it = names_.find(name);
+            if (it != names_.end()) {
+                return *it;
+            }
+
+            const char* const copy = copy_name(name);
+            if (!copy) {
+                return name;
+            }
+            names_.insert(copy);
+            return copy;
+#ifndef BOOST_NO_EXCEPTIONS
+        } catch (...) {
+            return name;
+        }
+#endif
+    }
+
+private:
+    struct name_hash {
+        std::size_t operator()(const char* name) const noexcept {
+            return detail::ctti_name_header_of(name).hash_;
+        }
+    };
+
+    struct name_equal {
+        bool operator()(const char* left, const char* right) const noexcept {
+            const std::size_t length = detail::ctti_name_header_of(left).length_;
+            return length == detail::ctti_name_header_of(right).length_
+                && !std::memcmp(left, right, length);
+        }
+    };
+
+    static const char* copy_name(const char* name) noexcept {
+        const std::size_t size = sizeof(ctti_name_header) + detail::ctti_name_header_of(name).length_ + 1;
+
+        // Array of std::size_t to keep the alignment of ctti_name_header
+        std::size_t* const storage = new (std::nothrow) std::size_t[
+            (size + sizeof(std::size_t) - 1) / sizeof(std::size_t)
+        ];
+        if (!storage) {
+            return nullptr;
+        }
+
+        std::memcpy(storage, name - sizeof(ctti_name_header), size);
+        return reinterpret_cast<const char*>(storage) + sizeof(ctti_name_header);
+    }
+
+    std::mutex mutex_;
+    std::unordered_set<const char*, name_hash, name_equal> names_;
+};
+
+// Must have a single instance in the whole process, even if modules are
+// built with hidden visibility. The registry is never destroyed, so that
+// type_index instances remain usable in destructors of static objects.
+BOOST_SYMBOL_VISIBLE inline ctti_intern_registry& ctti_intern_registry_instance() noexcept {
+    static ctti_intern_registry* const instance = new ctti_intern_registry();
+    return *instance;
+}
+
+template <class T>
+inline const char* ctti_interned_name() noexcept {
+    static const char* const name = detail::ctti_intern_registry_instance().intern(
+        boost::typeindex::detail::postprocessed_name<T>()
+    );
+    return name;
+}
+
+}}} // namespace boost::typeindex::detail
+
+#endif // #if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+#endif // BOOST_TYPE_INDEX_DETAIL_CTTI_INTERN_HPP
@@ -0,0 +1,42 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_HASH_MIX_HPP
+#define BOOST_TYPE_INDEX_DETAIL_HASH_MIX_HPP
+
+/// \file hash_mix.hpp
+/// \brief Contains the mixing of hash_code() values for the hash tables of the library.
+/// Not intended for inclusion from user's code.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+// hash_code() of user defined type indexes may be an address with all the low
+// bits set to zero, so the tables that use the low bits mix the hash first.
+// The mix is a bijection, so mixed hashes are equal only for equal hashes.
+inline std::size_t hash_mix(std::size_t hash) noexcept {
+    hash ^= hash >> (sizeof(std::size_t) * 4);
+    hash *= static_cast<std::size_t>(0xFF51AFD7ED558CCDULL);
+    hash ^= hash >> (sizeof(std::size_t) * 4);
+    return hash;
+}
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_HASH_MIX_HPP
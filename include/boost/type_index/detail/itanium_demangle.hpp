@@ -0,0 +1,484 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_ITANIUM_DEMANGLE_HPP
+#define BOOST_TYPE_INDEX_DETAIL_ITANIUM_DEMANGLE_HPP
+
+/// \file itanium_demangle.hpp
+/// \brief Contains the demangler of type names in Itanium C++ ABI that is used by
+/// stl_type_index::pretty_name() if BOOST_TYPE_INDEX_BUILTIN_DEMANGLE is defined.
+/// Not intended for inclusion from user's code.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#include <cstring>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+// Size of the buffer that is enough for most of the type names
+constexpr std::size_t itanium_demangle_buffer_size = 1024;
+
+// Demangles the subset of Itanium C++ ABI that std::type_info::name() produces
+// for class types, their templates and pointers and references to them. Output
+// is the same as the one of __cxa_demangle from libstdc++. Does not allocate
+// memory: the output and the substitutions live in the caller provided buffer
+// and in the object itself.
+//
+// Types that are mangled with the constructs that are not supported (function,
+// array and member pointer types, local and unnamed classes, lambdas, template
+// parameters and expressions) are not demangled, the caller should fall back to
+// __cxa_demangle for them.
+class itanium_type_demangler {
+public:
+    itanium_type_demangler(const char* mangled, char* buffer, std::size_t size) noexcept
+        : in_(mangled)
+        , begin_(buffer)
+        , out_(buffer)
+        , end_(buffer + size)
+        , substitutions_count_(0)
+        , depth_(0)
+    {}
+
+    itanium_type_demangler(const itanium_type_demangler&) = delete;
+    itanium_type_demangler& operator=(const itanium_type_demangler&) = delete;
+
+    // Returns the length of the demangled name written to the buffer or 0 if the name
+    // could not be demangled. The name in the buffer is not zero terminated.
+    //
+    // Type names of boost::typeindex::detail::cvr_saver<T> are demangled to the name
+    // of T, as stl_type_index::pretty_name() requires.
+    std::size_t demangle() noexcept {
+        static const char cvr_saver[] = "N5boost9typeindex6detail9cvr_saverI";
+        constexpr std::size_t cvr_saver_length = sizeof(cvr_saver) - 1;
+
+        if (!std::strncmp(in_, cvr_saver, cvr_saver_length)) {
+            in_ += cvr_saver_length;
+            add_substitution("boost");
+            add_substitution("boost::typeindex");
+            add_substitution("boost::typeindex::detail");
+            add_substitution("boost::typeindex::detail::cvr_saver");
+            if (!type() || std::strcmp(in_, "EE")) {
+                return 0;
+            }
+        } else if (!type() || *in_) {
+            return 0;
+        }
+        return static_cast<std::size_t>(out_ - begin_);
+    }
+
+private:
+    static constexpr std::size_t max_substitutions = 128;
+    static constexpr std::size_t max_depth = 64;
+
+    struct substitution_entry {
+        const char* begin_;
+        std::size_t length_;
+    };
+
+    bool append(const char* s, std::size_t length) noexcept {
+        if (static_cast<std::size_t>(end_ - out_) < length) {
+            return false;
+        }
+        std::memcpy(out_, s, length);
+        out_ += length;
+        return true;
+    }
+
+    bool append(const char* s) noexcept {
+        return append(s, std::strlen(s));
+    }
+
+    bool add_substitution(const char* s) noexcept {
+        return add_substitution(s, std::strlen(s));
+    }
+
+    bool add_substitution(const char* s, std::size_t length) noexcept {
+        if (substitutions_count_ == max_substitutions) {
+            return false;
+        }
+        substitutions_[substitutions_count_].begin_ = s;
+        substitutions_[substitutions_count_].length_ = length;
+        ++substitutions_count_;
+        return true;
+    }
+
+    // Remembers the output since `start` as a substitution candidate
+    bool add_substitution(char* start) noexcept {
+        return add_substitution(start, static_cast<std::size_t>(out_ - start));
+    }
+
+    static const char* builtin_type_name(char c) noexcept {
+        switch (c) {
+        case 'v': return "void";
+        case 'w': return "wchar_t";
+        case 'b': return "bool";
+        case 'c': return "char";
+        case 'a': return "signed char";
+        case 'h': return "unsigned char";
+        case 's': return "short";
+        case 't': return "unsigned short";
+        case 'i': return "int";
+        case 'j': return "unsigned int";
+        case 'l': return "long";
+        case 'm': return "unsigned long";
+        case 'x': return "long long";
+        case 'y': return "unsigned long long";
+        case 'n': return "__int128";
+        case 'o': return "unsigned __int128";
+        case 'f': return "float";
+        case 'd': return "double";
+        case 'e': return "long double";
+        case 'g': return "__float128";
+        case 'z': return "...";
+        default: return nullptr;
+        }
+    }
+
+    static const char* extended_builtin_type_name(char c) noexcept {
+        switch (c) {
+        case 'n': return "decltype(nullptr)";
+        case 'i': return "char32_t";
+        case 's': return "char16_t";
+        case 'u': return "char8_t";
+        default: return nullptr;
+        }
+    }
+
+    // <type>
+    bool type() noexcept {
+        if (++depth_ > max_depth) {
+            return false;
+        }
+        const bool result = type_impl();
+        --depth_;
+        return result;
+    }
+
+    bool type_impl() noexcept {
+        char* const start = out_;
+        const char c = *in_;
+
+        if (const char* const name = builtin_type_name(c)) {
+            ++in_;
+            return append(name);
+        }
+
+        switch (c) {
+        case 'D':
+            if (const char* const name = extended_builtin_type_name(in_[1])) {
+                in_ += 2;
+                return append(name);
+            }
+            return false;
+
+        case 'V':
+        case 'K': {
+            // <CV-qualifiers> ::= [r] [V] [K], printed as "T const volatile"
+            const bool is_volatile = (*in_ == 'V');
+            if (is_volatile) {
+                ++in_;
+            }
+            const bool is_const = (*in_ == 'K');
+            if (is_const) {
+                ++in_;
+            }
+            return type()
+                && (!is_const || append(" const"))
+                && (!is_volatile || append(" volatile"))
+                && add_substitution(start);
+        }
+
+        case 'P':
+            ++in_;
+            return type() && append("*") && add_substitution(start);
+        case 'R':
+            ++in_;
+            return type() && append("&") && add_substitution(start);
+        case 'O':
+            ++in_;
+            return type() && append("&&") && add_substitution(start);
+
+        case 'S':
+            if (in_[1] != 't') {
+                // Substitution of a type or of a template name
+                if (!substitution()) {
+                    return false;
+                }
+                if (*in_ != 'I') {
+                    return true;
+                }
+                return template_args() && add_substitution(start);
+            }
+            return name() && add_substitution(start);
+
+        case 'N':
+            return name() && add_substitution(start);
+
+        default:
+            if (c >= '0' && c <= '9') {
+                return name() && add_substitution(start);
+            }
+            return false;
+        }
+    }
+
+    // <name> of a class type, without the substitution for the whole name
+    bool name() noexcept {
+        if (*in_ == 'N') {
+            ++in_;
+            return nested_name();
+        }
+
+        char* const start = out_;
+        if (in_[0] == 'S' && in_[1] == 't') {
+            in_ += 2;
+            if (!append("std::")) {
+                return false;
+            }
+        }
+        if (!source_name()) {
+            return false;
+        }
+        if (*in_ == 'I') {
+            return add_substitution(start) && template_args();
+        }
+        return true;
+    }
+
+    // <nested-name> ::= N <prefix> <unqualified-name> E, without the leading N
+    bool nested_name() noexcept {
+        char* const start = out_;
+        bool first = true;
+        while (*in_ != 'E') {
+            bool substitutable = true;
+            if (*in_ == 'S' && first) {
+                if (in_[1] == 't') {
+                    in_ += 2;
+                    substitutable = false;
+                    if (!append("std")) {
+                        return false;
+                    }
+                } else {
+                    substitutable = false;
+                    if (!substitution()) {
+                        return false;
+                    }
+                }
+            } else if (*in_ == 'I' && !first) {
+                if (!template_args()) {
+                    return false;
+                }
+            } else if (*in_ >= '0' && *in_ <= '9') {
+                if ((!first && !append("::")) || !source_name()) {
+                    return false;
+                }
+            } else {
+                return false;
+            }
+
+            first = false;
+            if (substitutable && *in_ != 'E' && !add_substitution(start)) {
+                return false;
+            }
+        }
+
+        ++in_;
+        return !first;
+    }
+
+    // <source-name> ::= <positive length number> <identifier>
+    bool source_name() noexcept {
+        std::size_t length = 0;
+        if (*in_ < '1' || *in_ > '9') {
+            return false;
+        }
+        while (*in_ >= '0' && *in_ <= '9') {
+            length = length * 10 + static_cast<std::size_t>(*in_ - '0');
+            if (length > 4096) {
+                return false;
+            }
+            ++in_;
+        }
+
+        for (std::size_t i = 0; i < length; ++i) {
+            if (!in_[i]) {
+                return false;
+            }
+        }
+
+        static const char anonymous_namespace[] = "_GLOBAL_";
+        constexpr std::size_t anonymous_namespace_length = sizeof(anonymous_namespace) - 1;
+        const bool is_anonymous_namespace = length > anonymous_namespace_length + 1
+            && !std::memcmp(in_, anonymous_namespace, anonymous_namespace_length)
+            && (in_[anonymous_namespace_length] == '.' || in_[anonymous_namespace_length] == '_'
+                || in_[anonymous_namespace_length] == '$')
+            && in_[anonymous_namespace_length + 1] == 'N';
+
+        const bool result = is_anonymous_namespace ? append("(anonymous namespace)") : append(in_, length);
+        in_ += length;
+        return result;
+    }
+
+    // <substitution>, without the template arguments that may follow it
+    bool substitution() noexcept {
+        ++in_;  // 'S'
+        switch (*in_) {
+        case 'a':
+            ++in_;
+            return append("std::allocator");
+        case 'b':
+            ++in_;
+            return append("std::basic_string");
+        default:
+            break;
+        }
+
+        // S_ is the first substitution, S<base 36 number>_ is the number + 2 one
+        std::size_t index = 0;
+        if (*in_ != '_') {
+            std::size_t id = 0;
+            while (*in_ != '_') {
+                const char c = *in_;
+                if (c >= '0' && c <= '9') {
+                    id = id * 36 + static_cast<std::size_t>(c - '0');
+                } else if (c >= 'A' && c <= 'Z') {
+                    id = id * 36 + static_cast<std::size_t>(c - 'A') + 10;
+                } else {
+                    return false;
+                }
+                if (id >= max_substitutions) {
+                    return false;
+                }
+                ++in_;
+            }
+            index = id + 1;
+        }
+        ++in_;  // '_'
+
+        if (index >= substitutions_count_) {
+            return false;
+        }
+        return append(substitutions_[index].begin_, substitutions_[index].length_);
+    }
+
+    // <template-args> ::= I <template-arg>+ E
+    bool template_args() noexcept {
+        ++in_;  // 'I'
+        if (!append("<") || !template_arg_list()) {
+            return false;
+        }
+        return out_[-1] == '>' ? append(" >") : append(">");
+    }
+
+    // Prints arguments till the E separated by commas, like libstdc++ does:
+    // the comma before an empty argument pack is not printed.
+    bool template_arg_list() noexcept {
+        bool first = true;
+        while (*in_ != 'E') {
+            if (first) {
+                if (!template_arg()) {
+                    return false;
+                }
+                first = false;
+                continue;
+            }
+
+            char* const comma = out_;
+            if (!append(", ") || !template_arg()) {
+                return false;
+            }
+            if (out_ == comma + 2) {
+                out_ = comma;
+            }
+        }
+        ++in_;  // 'E'
+        return true;
+    }
+
+    // <template-arg> ::= <type> | L <expr-primary> | J <template-arg>* E
+    bool template_arg() noexcept {
+        switch (*in_) {
+        case 'L':
+            ++in_;
+            return literal();
+        case 'J':
+            ++in_;
+            return template_arg_list();
+        default:
+            return type();
+        }
+    }
+
+    // <expr-primary> ::= L <type> <value number> E, without the leading L
+    bool literal() noexcept {
+        const char* suffix = nullptr;
+        switch (*in_) {
+        case 'i': suffix = ""; break;
+        case 'j': suffix = "u"; break;
+        case 'l': suffix = "l"; break;
+        case 'm': suffix = "ul"; break;
+        case 'x': suffix = "ll"; break;
+        case 'y': suffix = "ull"; break;
+        case 'b':
+            if ((in_[1] == '0' || in_[1] == '1') && in_[2] == 'E') {
+                const bool value = (in_[1] == '1');
+                in_ += 3;
+                return append(value ? "true" : "false");
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (suffix) {
+            ++in_;
+        } else if (!append("(") || !type() || !append(")")) {
+            return false;
+        }
+
+        if (*in_ == 'n') {
+            ++in_;
+            if (!append("-")) {
+                return false;
+            }
+        }
+
+        const char* const value = in_;
+        while (*in_ >= '0' && *in_ <= '9') {
+            ++in_;
+        }
+        if (in_ == value || *in_ != 'E') {
+            return false;
+        }
+        const std::size_t length = static_cast<std::size_t>(in_ - value);
+        ++in_;  // 'E'
+        return append(value, length) && (!suffix || append(suffix));
+    }
+
+    const char* in_;
+    char* const begin_;
+    char* out_;
+    char* const end_;
+
+    substitution_entry substitutions_[max_substitutions];
+    std::size_t substitutions_count_;
+    std::size_t depth_;
+};
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_ITANIUM_DEMANGLE_HPP
@@ -0,0 +1,176 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_LOCK_FREE_MAP_HPP
+#define BOOST_TYPE_INDEX_DETAIL_LOCK_FREE_MAP_HPP
+
+/// \file lock_free_map.hpp
+/// \brief Contains the insert only hash table with lookups that do not lock. Used by the process wide
+/// caches of the library.
+/// Not intended for inclusion from user's code.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+inline std::size_t lock_free_map_hash(std::size_t key) noexcept {
+    key ^= key >> 7;
+    key *= static_cast<std::size_t>(0x9E3779B97F4A7C15ULL);
+    return key ^ (key >> (sizeof(std::size_t) * 4));
+}
+
+inline std::size_t lock_free_map_hash(const void* key) noexcept {
+    return detail::lock_free_map_hash(static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(key)));
+}
+
+// Maps keys to values. Key is a pointer or an integer, Key() marks the empty slots and must
+// not be inserted. Lookups do not lock. Entries are never modified or removed and slot arrays
+// that were replaced during growth are kept alive, so a concurrent reader never observes freed memory.
+template <class Key, class Value>
+class lock_free_map {
+public:
+    lock_free_map()
+        : current_(nullptr)
+        , size_(0)
+    {}
+
+    lock_free_map(const lock_free_map&) = delete;
+    lock_free_map& operator=(const lock_free_map&) = delete;
+
+    ~lock_free_map() {
+        for (slots_type* slots = current_.load(std::memory_order_relaxed); slots; ) {
+            slots_type* const retired = slots->retired_;
+            delete slots;
+            slots = retired;
+        }
+    }
+
+    // Returns true and sets `value` if there is a value for `key`.
+    bool find(Key key, Value& value) const noexcept {
+        const slots_type* slots = current_.load(std::memory_order_acquire);
+        if (!slots) {
+            return false;
+        }
+
+        const std::size_t mask = slots->size_ - 1;
+        for (std::size_t i = detail::lock_free_map_hash(key) & mask;; i = (i + 1) & mask) {
+            const Key k = slots->data_[i].key_.load(std::memory_order_acquire);
+            if (k == key) {
+                value = slots->data_[i].value_;
+                return true;
+            }
+            if (k == Key()) {
+                return false;
+            }
+        }
+    }
+
+    // Remembers the value if there is no value for `key`. Silently does nothing if there is not enough memory.
+    void insert(Key key, const Value& value) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots_type* slots = current_.load(std::memory_order_relaxed);
+        if (!slots || (size_ + 1) * 2 > slots->size_) {
+            slots = grow(slots ? slots->size_ * 2 : 16);
+            if (!slots) {
+                return;
+            }
+        }
+
+        if (place(*slots, key, value)) {
+            ++size_;
+        }
+    }
+
+private:
+    // Value is written once before the key is published and is never modified after that
+    struct slot_type {
+        std::atomic<Key> key_;
+        Value value_;
+    };
+
+    struct slots_type {
+        slots_type(std::size_t size, slots_type* retired) noexcept
+            : size_(size)
+            , retired_(retired)
+            , data_(new (std::nothrow) slot_type[size])
+        {
+            for (std::size_t i = 0; data_ && i < size_; ++i) {
+                data_[i].key_.store(Key(), std::memory_order_relaxed);
+            }
+        }
+
+        slots_type(const slots_type&) = delete;
+        slots_type& operator=(const slots_type&) = delete;
+
+        ~slots_type() {
+            delete[] data_;
+        }
+
+        const std::size_t size_;  // always a power of 2
+        slots_type* const retired_;  // previous array of slots
+        slot_type* const data_;
+    };
+
+    // Value is published before the key, so readers that see the key also see the value
+    static bool place(slots_type& slots, Key key, const Value& value) noexcept {
+        const std::size_t mask = slots.size_ - 1;
+        std::size_t i = detail::lock_free_map_hash(key) & mask;
+        for (Key k; (k = slots.data_[i].key_.load(std::memory_order_relaxed)) != Key(); i = (i + 1) & mask) {
+            if (k == key) {
+                return false;
+            }
+        }
+        slots.data_[i].value_ = value;
+        slots.data_[i].key_.store(key, std::memory_order_release);
+        return true;
+    }
+
+    slots_type* grow(std::size_t new_size) noexcept {
+        slots_type* const old = current_.load(std::memory_order_relaxed);
+        slots_type* const slots = new (std::nothrow) slots_type(new_size, old);
+        if (!slots || !slots->data_) {
+            delete slots;
+            return nullptr;
+        }
+
+        if (old) {
+            for (std::size_t i = 0; i < old->size_; ++i) {
+                const Key k = old->data_[i].key_.load(std::memory_order_relaxed);
+                if (k != Key()) {
+                    place(*slots, k, old->data_[i].value_);
+                }
+            }
+        }
+
+        current_.store(slots, std::memory_order_release);
+        return slots;
+    }
+
+    std::atomic<slots_type*> current_;  // current array of slots, it owns the retired ones
+    std::size_t size_;
+
+    std::mutex mutex_;
+};
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_LOCK_FREE_MAP_HPP
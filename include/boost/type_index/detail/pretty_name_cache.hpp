@@ -0,0 +1,225 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_PRETTY_NAME_CACHE_HPP
+#define BOOST_TYPE_INDEX_DETAIL_PRETTY_NAME_CACHE_HPP
+
+/// \file pretty_name_cache.hpp
+/// \brief Contains the process wide cache of human readable type names that is used by
+/// boost::typeindex::pretty_name_cstr().
+/// Not intended for inclusion from user's code.
+
+#include <boost/type_index/detail/config.hpp>
+#include <boost/type_index/detail/lock_free_map.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+// Maps types to copies of their pretty names.
+//
+// The first lookup for a type is by the address of its type_info and by the
+// address of its raw name, it does not lock, does not allocate and does not
+// look at the characters of the names. On a miss the raw name is looked up by
+// its contents, so the same type seen through different type_info objects, for
+// example from different shared libraries, shares a single name. A type_info
+// of an unloaded library is matched only if a new one appears at the same
+// address with the raw name at the same address, that is if the same library
+// was loaded again.
+//
+// Copies of the names are allocated from blocks that are freed only with the
+// cache, so pointers to them stay valid as long as the cache is alive.
+class pretty_name_cache {
+public:
+    pretty_name_cache() = default;
+    pretty_name_cache(const pretty_name_cache&) = delete;
+    pretty_name_cache& operator=(const pretty_name_cache&) = delete;
+
+    ~pretty_name_cache() {
+        while (last_) {
+            const node* const older = last_->older_;
+            delete last_;
+            last_ = older;
+        }
+
+        while (blocks_) {
+            char* previous;
+            std::memcpy(&previous, blocks_, sizeof(previous));
+            delete[] blocks_;
+            blocks_ = previous;
+        }
+    }
+
+    // Returns the remembered name for the type with the type_info at `identity` or nullptr.
+    const char* find(const void* identity, const char* raw_name) const noexcept {
+        identity_entry entry;
+        if (identities_.find(identity, entry) && entry.raw_name_ == raw_name) {
+            return entry.name_;
+        }
+        return nullptr;
+    }
+
+    // Returns the remembered name for `raw_name` compared by contents or nullptr.
+    const char* find(const char* raw_name) const noexcept {
+        return find(raw_name, hash(raw_name));
+    }
+
+    // Remembers `name` that was returned by find() or insert() for the type with the type_info at `identity`.
+    // Silently does nothing if there is not enough memory.
+    void remember(const void* identity, const char* raw_name, const char* name) noexcept {
+        identity_entry entry;
+        entry.raw_name_ = raw_name;
+        entry.name_ = name;
+        identities_.insert(identity, entry);
+    }
+
+    // Copies the names and remembers them. Returns the remembered copy of `name` or nullptr if there is not enough memory.
+    const char* insert(const char* raw_name, const char* name, std::size_t length) noexcept {
+        const std::size_t key = hash(raw_name);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (const char* const existing = find(raw_name, key)) {
+            return existing;
+        }
+
+        const std::size_t raw_length = std::strlen(raw_name);
+        char* const raw_copy = allocate(raw_length + 1);
+        char* const copy = allocate(length + 1);
+        node* const n = new (std::nothrow) node();
+        if (!raw_copy || !copy || !n) {
+            // Memory of the blocks is freed with the cache, only the node is freed here
+            delete n;
+            return nullptr;
+        }
+        std::memcpy(raw_copy, raw_name, raw_length + 1);
+        std::memcpy(copy, name, length);
+        copy[length] = '\0';
+        n->raw_name_ = raw_copy;
+        n->name_ = copy;
+        n->older_ = last_;
+        last_ = n;
+
+        const node* head = nullptr;
+        if (!names_.find(key, head)) {
+            // Not remembered if there is not enough memory, but the copy stays valid
+            names_.insert(key, n);
+            return copy;
+        }
+
+        // Hash collision, names with the same hash are chained
+        while (const node* const next = head->next_.load(std::memory_order_relaxed)) {
+            head = next;
+        }
+        const_cast<node*>(head)->next_.store(n, std::memory_order_release);
+        return copy;
+    }
+
+private:
+    // Immutable after publishing, except for the `next_` of the last node in a chain
+    struct node {
+        const char* raw_name_ = nullptr;
+        const char* name_ = nullptr;
+        std::atomic<const node*> next_{nullptr};
+        const node* older_ = nullptr;  // previously inserted node, for the destructor
+    };
+
+    struct identity_entry {
+        const char* raw_name_ = nullptr;
+        const char* name_ = nullptr;
+    };
+
+    // FNV-1a, never returns 0 as it is the empty key of lock_free_map
+    static std::size_t hash(const char* raw_name) noexcept {
+        std::size_t result = static_cast<std::size_t>(14695981039346656037ULL);
+        for (; *raw_name; ++raw_name) {
+            result ^= static_cast<unsigned char>(*raw_name);
+            result *= static_cast<std::size_t>(1099511628211ULL);
+        }
+        return result ? result : 1;
+    }
+
+    const char* find(const char* raw_name, std::size_t key) const noexcept {
+        const node* n = nullptr;
+        if (!names_.find(key, n)) {
+            return nullptr;
+        }
+        for (; n; n = n->next_.load(std::memory_order_acquire)) {
+            if (!std::strcmp(n->raw_name_, raw_name)) {
+                return n->name_;
+            }
+        }
+        return nullptr;
+    }
+
+    static constexpr std::size_t block_size = 4096;
+
+    // Each block starts with the pointer to the previously allocated block
+    char* allocate_block(std::size_t size) noexcept {
+        char* const block = new (std::nothrow) char[sizeof(char*) + size];
+        if (!block) {
+            return nullptr;
+        }
+        std::memcpy(block, &blocks_, sizeof(char*));
+        blocks_ = block;
+        return block + sizeof(char*);
+    }
+
+    char* allocate(std::size_t size) noexcept {
+        if (size > block_size / 4) {
+            return allocate_block(size);
+        }
+
+        if (size > left_) {
+            char* const block = allocate_block(block_size);
+            if (!block) {
+                return nullptr;
+            }
+            next_ = block;
+            left_ = block_size;
+        }
+
+        char* const result = next_;
+        next_ += size;
+        left_ -= size;
+        return result;
+    }
+
+    lock_free_map<const void*, identity_entry> identities_;
+    lock_free_map<std::size_t, const node*> names_;
+
+    std::mutex mutex_;
+    const node* last_ = nullptr;
+    char* blocks_ = nullptr;
+    char* next_ = nullptr;
+    std::size_t left_ = 0;
+};
+
+// One cache per type_index class, shared by all the modules even if they are
+// built with hidden visibility. The cache is never destroyed, so that the names
+// remain usable in destructors of static objects.
+template <class TypeIndex>
+BOOST_SYMBOL_VISIBLE inline pretty_name_cache& pretty_name_cache_instance() noexcept {
+    static pretty_name_cache* const instance = new pretty_name_cache();
+    return *instance;
+}
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_PRETTY_NAME_CACHE_HPP
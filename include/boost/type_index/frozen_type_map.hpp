@@ -0,0 +1,405 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_FROZEN_TYPE_MAP_HPP
+#define BOOST_TYPE_INDEX_FROZEN_TYPE_MAP_HPP
+
+/// \file frozen_type_map.hpp
+/// \brief Contains boost::typeindex::frozen_type_map class - an immutable map with
+/// boost::typeindex::type_index keys that uses a minimal perfect hash.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#endif
+
+#include <boost/throw_exception.hpp>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+namespace detail {
+
+// Builds a minimal perfect hash function for a set of distinct hashes using
+// the "hash, displace and compress" approach. Hashes are split into buckets,
+// and for each bucket a seed is searched that places all the bucket hashes
+// into free slots. Buckets with a single hash store the slot index directly.
+//
+// Buckets are chosen by the mixed hash, because the low bits of hash_code()
+// could be the same for many keys, for example for the pointers to names.
+struct frozen_type_map_hash {
+    static constexpr std::size_t direct_flag = ~(~static_cast<std::size_t>(0) >> 1);
+
+    static std::size_t mix(std::size_t hash, std::size_t seed) noexcept {
+        hash ^= seed * static_cast<std::size_t>(0x9E3779B97F4A7C15ULL);
+        hash ^= hash >> (sizeof(std::size_t) * 4);
+        hash *= static_cast<std::size_t>(0xFF51AFD7ED558CCDULL);
+        hash ^= hash >> (sizeof(std::size_t) * 4);
+        return hash;
+    }
+
+    static std::size_t bucket_of(std::size_t hash, std::size_t buckets_count) noexcept {
+        return mix(hash, 0) & (buckets_count - 1);
+    }
+
+    static std::size_t slot(std::size_t hash, std::size_t seed, std::size_t size) noexcept {
+        return (seed & direct_flag) ? (seed & ~direct_flag) : mix(hash, seed) % size;
+    }
+
+    // Returns seeds for each bucket, count of buckets is a power of 2. Slot of
+    // each hash is written into `slots`. Hashes must be distinct.
+    //
+    // Count of buckets is doubled after each failed attempt, up to the first
+    // power of 2 that is not less than twice the count of hashes.
+    static std::vector<std::size_t> build(const std::vector<std::size_t>& hashes, std::vector<std::size_t>& slots) {
+        std::size_t buckets_count = 1;
+        while (buckets_count * 4 < hashes.size()) {
+            buckets_count *= 2;
+        }
+
+        std::vector<std::size_t> seeds;
+        while (!try_build(hashes, buckets_count, seeds, slots)) {
+            if (buckets_count >= hashes.size() * 2) {
+                boost::throw_exception(std::runtime_error(
+                    "boost::typeindex::frozen_type_map: failed to build a perfect hash function for the keys"
+                ));
+            }
+            buckets_count *= 2;
+        }
+        return seeds;
+    }
+
+    // Orders `hashes.size()` keys for storage and returns the count of keys with
+    // distinct hashes. Those keys come first, ordered by their slots of the perfect
+    // hash function that is written into `seeds`. Keys with the same hash as one
+    // of them follow in the overflow area. `equal(i, j)` compares the keys with
+    // indexes `i` and `j` that have the same hash.
+    template <class Equal>
+    static std::size_t layout(const std::vector<std::size_t>& hashes, Equal equal,
+            std::vector<std::size_t>& seeds, std::vector<std::size_t>& order)
+    {
+        const std::size_t size = hashes.size();
+        std::vector<std::size_t> by_hash(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            by_hash[i] = i;
+        }
+        std::stable_sort(by_hash.begin(), by_hash.end(), [&hashes](std::size_t lhs, std::size_t rhs) {
+            return hashes[lhs] < hashes[rhs];
+        });
+
+        std::vector<std::size_t> distinct;
+        std::vector<std::size_t> overflow;
+        for (std::size_t first = 0; first < size; ) {
+            std::size_t last = first + 1;
+            while (last < size && hashes[by_hash[last]] == hashes[by_hash[first]]) {
+                for (std::size_t j = first; j < last; ++j) {
+                    if (equal(by_hash[j], by_hash[last])) {
+                        boost::throw_exception(std::invalid_argument("boost::typeindex::frozen_type_map: duplicate key"));
+                    }
+                }
+                overflow.push_back(by_hash[last]);
+                ++last;
+            }
+            distinct.push_back(by_hash[first]);
+            first = last;
+        }
+
+        std::vector<std::size_t> distinct_hashes(distinct.size());
+        for (std::size_t i = 0; i < distinct.size(); ++i) {
+            distinct_hashes[i] = hashes[distinct[i]];
+        }
+        std::vector<std::size_t> slots;
+        seeds = build(distinct_hashes, slots);
+
+        order.assign(size, 0);
+        for (std::size_t i = 0; i < distinct.size(); ++i) {
+            order[slots[i]] = distinct[i];
+        }
+        std::copy(overflow.begin(), overflow.end(), order.begin() + static_cast<std::ptrdiff_t>(distinct.size()));
+        return distinct.size();
+    }
+
+private:
+    static bool try_build(const std::vector<std::size_t>& hashes, std::size_t buckets_count,
+            std::vector<std::size_t>& seeds, std::vector<std::size_t>& slots)
+    {
+        const std::size_t size = hashes.size();
+        std::vector<std::vector<std::size_t> > buckets(buckets_count);
+        for (std::size_t i = 0; i < size; ++i) {
+            buckets[bucket_of(hashes[i], buckets_count)].push_back(i);
+        }
+
+        // Largest buckets are the hardest to place, so they go first
+        std::vector<std::size_t> order(buckets_count);
+        for (std::size_t i = 0; i < buckets_count; ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buckets](std::size_t lhs, std::size_t rhs) {
+            return buckets[lhs].size() > buckets[rhs].size();
+        });
+
+        seeds.assign(buckets_count, 0);
+        slots.assign(size, 0);
+        std::vector<bool> taken(size);
+        std::size_t free_slot = 0;
+
+        for (const std::size_t b : order) {
+            const std::vector<std::size_t>& bucket = buckets[b];
+            if (bucket.empty()) {
+                break;
+            }
+
+            if (bucket.size() == 1) {
+                while (taken[free_slot]) {
+                    ++free_slot;
+                }
+                taken[free_slot] = true;
+                slots[bucket.front()] = free_slot;
+                seeds[b] = direct_flag | free_slot;
+                continue;
+            }
+
+            if (!place_bucket(hashes, bucket, taken, seeds[b], slots)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static bool place_bucket(const std::vector<std::size_t>& hashes, const std::vector<std::size_t>& bucket,
+            std::vector<bool>& taken, std::size_t& seed, std::vector<std::size_t>& slots)
+    {
+        const std::size_t size = hashes.size();
+        for (seed = 1; seed < (1u << 16); ++seed) {
+            std::size_t placed = 0;
+            for (; placed < bucket.size(); ++placed) {
+                const std::size_t i = mix(hashes[bucket[placed]], seed) % size;
+                if (taken[i]) {
+                    break;
+                }
+                taken[i] = true;
+                slots[bucket[placed]] = i;
+            }
+
+            if (placed == bucket.size()) {
+                return true;
+            }
+
+            for (std::size_t j = 0; j < placed; ++j) {
+                taken[slots[bucket[j]]] = false;
+            }
+        }
+
+        return false;
+    }
+};
+
+} // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \class frozen_type_map
+/// Immutable map with boost::typeindex::type_index keys for the sets of types that do not
+/// change after initialization, for example tables of message handlers or factories.
+///
+/// On construction a minimal perfect hash function for the keys is built, and the elements are
+/// stored in a single array in the order of their hashes. Lookup costs a hash_code() call, computation
+/// of a slot and a single comparison of keys. There are no probing chains. Different keys with equal
+/// hash_code(), that are possible with 32 bit std::size_t or with user defined type indexes, are stored in
+/// a small overflow area that is scanned only if the key in the slot has the same hash but is not equal.
+///
+/// Keys could not be added or removed after construction, mapped values could be modified.
+/// Concurrent calls of the const member functions are safe.
+///
+/// \b Example:
+/// \code
+/// const boost::typeindex::frozen_type_map<handler_fn> handlers = {
+///     {boost::typeindex::type_id<ping>(), &on_ping},
+///     {boost::typeindex::type_id<pong>(), &on_pong},
+/// };
+/// const auto it = handlers.find(boost::typeindex::type_id_runtime(message));
+/// \endcode
+///
+/// \tparam V Type of the mapped values.
+template <class V>
+class frozen_type_map {
+public:
+    using key_type = type_index;
+    using mapped_type = V;
+    using value_type = std::pair<const type_index, V>;
+    using size_type = std::size_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    using storage_type = std::vector<value_type>;
+
+public:
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+
+    /// Constructs an empty map.
+    frozen_type_map() noexcept = default;
+
+    /// Constructs the map from a range of `value_type`.
+    ///
+    /// \throw std::invalid_argument if the range contains equal keys.
+    /// \throw std::runtime_error if a perfect hash function could not be built for the keys.
+    template <class InputIt>
+    frozen_type_map(InputIt first, InputIt last) {
+        build(storage_type(first, last));
+    }
+
+    /// Constructs the map from a list of `value_type`.
+    ///
+    /// \throw std::invalid_argument if the list contains equal keys.
+    /// \throw std::runtime_error if a perfect hash function could not be built for the keys.
+    frozen_type_map(std::initializer_list<value_type> values) {
+        build(storage_type(values));
+    }
+
+    iterator begin() noexcept { return values_.begin(); }
+    iterator end() noexcept { return values_.end(); }
+    const_iterator begin() const noexcept { return values_.begin(); }
+    const_iterator end() const noexcept { return values_.end(); }
+    const_iterator cbegin() const noexcept { return values_.begin(); }
+    const_iterator cend() const noexcept { return values_.end(); }
+
+    bool empty() const noexcept { return values_.empty(); }
+    size_type size() const noexcept { return values_.size(); }
+
+    mapped_type& at(const key_type& key) {
+        const std::size_t i = find_index(key);
+        if (i == values_.size()) {
+            boost::throw_exception(std::out_of_range("boost::typeindex::frozen_type_map::at: key not found"));
+        }
+        return values_[i].second;
+    }
+
+    const mapped_type& at(const key_type& key) const {
+        return const_cast<frozen_type_map&>(*this).at(key);
+    }
+
+    iterator find(const key_type& key) noexcept {
+        return values_.begin() + static_cast<std::ptrdiff_t>(find_index(key));
+    }
+
+    const_iterator find(const key_type& key) const noexcept {
+        return values_.begin() + static_cast<std::ptrdiff_t>(find_index(key));
+    }
+
+    size_type count(const key_type& key) const noexcept {
+        return find_index(key) != values_.size();
+    }
+
+    bool contains(const key_type& key) const noexcept {
+        return find_index(key) != values_.size();
+    }
+
+    void swap(frozen_type_map& other) noexcept {
+        values_.swap(other.values_);
+        hashes_.swap(other.hashes_);
+        seeds_.swap(other.seeds_);
+        std::swap(hashed_size_, other.hashed_size_);
+    }
+
+    friend void swap(frozen_type_map& lhs, frozen_type_map& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+private:
+    using perfect_hash = detail::frozen_type_map_hash;
+
+    std::size_t find_index(const key_type& key) const noexcept {
+        if (values_.empty()) {
+            return 0;
+        }
+
+        const std::size_t hash = key.hash_code();
+        const std::size_t i = perfect_hash::slot(hash, seeds_[perfect_hash::bucket_of(hash, seeds_.size())], hashed_size_);
+        if (hashes_[i] != hash) {
+            return values_.size();
+        }
+        if (keys_equal(values_[i].first, key)) {
+            return i;
+        }
+
+        // Different keys with the same hash_code(), rare enough for a linear scan
+        for (std::size_t j = hashed_size_; j < values_.size(); ++j) {
+            if (hashes_[j] == hash && keys_equal(values_[j].first, key)) {
+                return j;
+            }
+        }
+        return values_.size();
+    }
+
+    static bool keys_equal(const key_type& lhs, const key_type& rhs) noexcept {
+        return std::addressof(lhs.type_info()) == std::addressof(rhs.type_info()) || lhs == rhs;
+    }
+
+    void build(storage_type&& values) {
+        const std::size_t size = values.size();
+        if (!size) {
+            return;
+        }
+
+        std::vector<std::size_t> hashes(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            hashes[i] = values[i].first.hash_code();
+        }
+
+        std::vector<std::size_t> seeds;
+        std::vector<std::size_t> order;
+        const std::size_t hashed_size = perfect_hash::layout(hashes, [&values](std::size_t lhs, std::size_t rhs) {
+            return values[lhs].first == values[rhs].first;
+        }, seeds, order);
+
+        storage_type ordered;
+        ordered.reserve(size);
+        std::vector<std::size_t> ordered_hashes(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            ordered.emplace_back(values[order[i]].first, std::move(values[order[i]].second));
+            ordered_hashes[i] = hashes[order[i]];
+        }
+
+        values_.swap(ordered);
+        hashes_.swap(ordered_hashes);
+        seeds_.swap(seeds);
+        hashed_size_ = hashed_size;
+    }
+
+    storage_type values_;
+    std::vector<std::size_t> hashes_;
+    std::vector<std::size_t> seeds_;
+    std::size_t hashed_size_ = 0;  // count of the keys with distinct hashes, the rest are in the overflow area
+};
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_FROZEN_TYPE_MAP_HPP
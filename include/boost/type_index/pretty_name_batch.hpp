@@ -0,0 +1,261 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_PRETTY_NAME_BATCH_HPP
+#define BOOST_TYPE_INDEX_PRETTY_NAME_BATCH_HPP
+
+/// \file pretty_name_batch.hpp
+/// \brief Contains boost::typeindex::pretty_name_batch class that converts many names
+/// returned by std::type_info::name() into human readable names at once.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index/stl_type_index.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+namespace detail {
+
+// Finds identical names. Open addressing with linear probing, without an allocation per name.
+class raw_name_set {
+public:
+    explicit raw_name_set(std::size_t count) {
+        std::size_t capacity = 16;
+        while (capacity < count * 2) {
+            capacity *= 2;
+        }
+        slots_.resize(capacity);
+        names_.reserve(count);
+    }
+
+    // Returns the index of the name in names(), adding it if there is no identical name yet
+    std::size_t insert(const char* name) {
+        const std::size_t hash = hash_of(name);
+        for (std::size_t i = hash & (slots_.size() - 1); ; i = (i + 1) & (slots_.size() - 1)) {
+            slot& s = slots_[i];
+            if (!s.index) {
+                names_.push_back(name);
+                s.hash = hash;
+                s.index = names_.size();
+                return s.index - 1;
+            }
+            if (s.hash == hash && !std::strcmp(names_[s.index - 1], name)) {
+                return s.index - 1;
+            }
+        }
+    }
+
+    const std::vector<const char*>& names() const noexcept { return names_; }
+
+private:
+    // FNV-1a with a final mix, so that the low bits depend on all the characters
+    static std::size_t hash_of(const char* name) noexcept {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (; *name; ++name) {
+            hash ^= static_cast<unsigned char>(*name);
+            hash *= 1099511628211ULL;
+        }
+        hash ^= hash >> 32;
+        return static_cast<std::size_t>(hash);
+    }
+
+    struct slot {
+        std::size_t hash = 0;
+        std::size_t index = 0;  // index in names_ plus one, zero for empty slots
+    };
+
+    std::vector<slot> slots_;
+    std::vector<const char*> names_;
+};
+
+}  // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \class pretty_name_batch
+/// Human readable names for a batch of names returned by std::type_info::name(), for example
+/// names that were received from other processes.
+///
+/// Each distinct input is demangled only once, with the same cleanup as in
+/// boost::typeindex::stl_type_index::pretty_name(). Names are stored one after another in a single
+/// buffer, each one is followed by '\0'. Identical inputs share the same name in the buffer.
+///
+/// \b Example:
+/// \code
+/// const char* raw_names[] = {typeid(int).name(), typeid(std::string).name(), typeid(int).name()};
+/// const boost::typeindex::pretty_name_batch names(raw_names, 3, std::thread::hardware_concurrency());
+/// for (std::size_t i = 0; i < names.size(); ++i) {
+///     std::cout << names[i] << '\n';
+/// }
+/// \endcode
+class pretty_name_batch {
+public:
+    pretty_name_batch() = default;
+
+    /// Demangles `count` zero terminated names from `raw_names`.
+    ///
+    /// \param raw_names Names returned by std::type_info::name() in any process built with the same compiler.
+    /// Names that can not be demangled are copied as is.
+    /// \param count Count of the names.
+    /// \param threads Maximal count of threads to use, including the calling thread. If new threads can not be
+    /// started the work is done by the calling thread. If BOOST_NO_EXCEPTIONS is defined all the work is done by
+    /// the calling thread.
+    /// \throw Nothing except std::bad_alloc.
+    pretty_name_batch(const char* const* raw_names, std::size_t count, std::size_t threads = 1);
+
+    /// \return Count of the names, equal to the count of the inputs.
+    std::size_t size() const noexcept { return offsets_.size(); }
+
+    /// \return Zero terminated human readable name of the `i`-th input.
+    const char* operator[](std::size_t i) const noexcept { return names_.data() + offsets_[i]; }
+
+    /// \return Length of the name of the `i`-th input, not counting the terminating '\0'.
+    std::size_t length(std::size_t i) const noexcept { return lengths_[i]; }
+
+    /// \return Buffer with all the distinct names, each one is followed by '\0'.
+    const std::string& buffer() const noexcept { return names_; }
+
+    /// \return Offsets of the names of the inputs in buffer().
+    const std::vector<std::size_t>& offsets() const noexcept { return offsets_; }
+
+private:
+    std::string names_;
+    std::vector<std::size_t> offsets_;
+    std::vector<std::size_t> lengths_;
+};
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+inline pretty_name_batch::pretty_name_batch(const char* const* raw_names, std::size_t count, std::size_t threads)
+    : offsets_(count)
+    , lengths_(count)
+{
+    // offsets_ temporarily hold the indexes of the inputs in `unique`
+    detail::raw_name_set seen(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        offsets_[i] = seen.insert(raw_names[i]);
+    }
+    const std::vector<const char*>& unique = seen.names();
+
+    if (threads > unique.size()) {
+        threads = unique.size();
+    }
+    if (!threads) {
+        threads = 1;
+    }
+#ifdef BOOST_NO_EXCEPTIONS
+    // Failures to start a thread can not be detected without exceptions
+    threads = 1;
+#endif
+
+    // Each part of `unique` is demangled into a separate string and the strings are concatenated afterwards
+    const std::size_t part_size = (unique.size() + threads - 1) / threads;
+    std::vector<std::string> parts(threads);
+    std::vector<std::size_t> unique_offsets(unique.size());
+    std::vector<std::size_t> unique_lengths(unique.size());
+#ifndef BOOST_NO_EXCEPTIONS
+    std::vector<std::exception_ptr> errors(threads);
+#endif
+
+    const auto demangle_part = [&](std::size_t part) {
+#ifndef BOOST_NO_EXCEPTIONS
+        try {
+#endif
+            std::string& out = parts[part];
+            const std::size_t end = (std::min)(unique.size(), (part + 1) * part_size);
+            for (std::size_t i = part * part_size; i < end; ++i) {
+                unique_offsets[i] = out.size();
+                if (!impl::append_pretty_name(unique[i], out)) {
+                    out.append(unique[i]);
+                }
+                unique_lengths[i] = out.size() - unique_offsets[i];
+                out.push_back('\0');
+            }
+#ifndef BOOST_NO_EXCEPTIONS
+        } catch (...) {
+            errors[part] = std::current_exception();
+        }
+#endif
+    };
+
+#ifndef BOOST_NO_EXCEPTIONS
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    try {
+        for (std::size_t part = 1; part < threads; ++part) {
+            workers.emplace_back(demangle_part, part);
+        }
+    } catch (...) {
+        // Not enough resources for a thread, the rest of the parts are demangled by the calling thread
+    }
+
+    demangle_part(0);
+    for (std::size_t part = workers.size() + 1; part < threads; ++part) {
+        demangle_part(part);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+#else
+    demangle_part(0);
+#endif
+
+    std::size_t total = 0;
+    for (const std::string& part : parts) {
+        total += part.size();
+    }
+    names_ = std::move(parts[0]);
+    names_.reserve(total);
+    for (std::size_t part = 1; part < threads; ++part) {
+        const std::size_t base = names_.size();
+        names_ += parts[part];
+        std::string().swap(parts[part]);
+
+        const std::size_t end = (std::min)(unique.size(), (part + 1) * part_size);
+        for (std::size_t i = part * part_size; i < end; ++i) {
+            unique_offsets[i] += base;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t index = offsets_[i];
+        offsets_[i] = unique_offsets[index];
+        lengths_[i] = unique_lengths[index];
+    }
+}
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_PRETTY_NAME_BATCH_HPP
@@ -0,0 +1,123 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_PRETTY_NAME_CSTR_HPP
+#define BOOST_TYPE_INDEX_PRETTY_NAME_CSTR_HPP
+
+/// \file pretty_name_cstr.hpp
+/// \brief Contains boost::typeindex::pretty_name_cstr() and boost::typeindex::pretty_name_to() functions that
+/// return human readable type names from a process wide cache, without allocating memory after the first
+/// call for each type.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index/ctti_type_index.hpp>
+#include <boost/type_index/detail/pretty_name_cache.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string>
+#endif
+
+#include <boost/throw_exception.hpp>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \return Human readable name of the type, same as `ti.pretty_name()`. The returned pointer stays valid till
+/// the end of the program.
+///
+/// `ti.pretty_name()` is called once for each type and its result is kept in a process wide cache. Following
+/// calls for the same type find the name by the address of `ti.type_info()`, they do not lock, do not allocate
+/// memory and do not look at the characters of the name. The same type seen through a different type_info, for
+/// example from another shared library, is found by the contents of `ti.raw_name()`.
+///
+/// \b Example:
+/// \code
+/// #include <boost/type_index/pretty_name_cstr.hpp>
+///
+/// std::printf("%s\n", boost::typeindex::pretty_name_cstr(boost::typeindex::type_id<T>()));
+/// \endcode
+///
+/// \throw Nothing except std::bad_alloc and the exceptions of `ti.pretty_name()`.
+template <class TypeIndex>
+inline const char* pretty_name_cstr(const TypeIndex& ti) {
+    const void* const identity = &ti.type_info();
+    const char* const raw_name = ti.raw_name();
+    detail::pretty_name_cache& cache = detail::pretty_name_cache_instance<TypeIndex>();
+    if (const char* const name = cache.find(identity, raw_name)) {
+        return name;
+    }
+
+    const char* result = cache.find(raw_name);
+    if (!result) {
+        const std::string name = ti.pretty_name();
+        result = cache.insert(raw_name, name.c_str(), name.size());
+        if (!result) {
+            boost::throw_exception(std::bad_alloc());
+        }
+    }
+    cache.remember(identity, raw_name, result);
+    return result;
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+/// \return Human readable name of the type. Names of ctti_type_index are already zero terminated at the end
+/// of the pretty name, so they are returned as is without caching.
+inline const char* pretty_name_cstr(const ctti_type_index& ti) noexcept {
+    return ti.raw_name();
+}
+#endif
+
+/// Writes the human readable type name to `buffer` like std::snprintf does: at most `size - 1` characters
+/// followed by a terminating zero, nothing if `size` is 0. Copies the name from pretty_name_cstr(), so memory
+/// is allocated only on the first call for each type.
+/// \return Length of the whole name. The name was truncated if the returned value is not less than `size`.
+/// \throw Nothing except std::bad_alloc and the exceptions of `ti.pretty_name()`.
+template <class TypeIndex>
+inline std::size_t pretty_name_to(const TypeIndex& ti, char* buffer, std::size_t size) {
+    const char* const name = boost::typeindex::pretty_name_cstr(ti);
+    const std::size_t length = std::strlen(name);
+    if (size) {
+        const std::size_t count = (length < size ? length : size - 1);
+        std::memcpy(buffer, name, count);
+        buffer[count] = '\0';
+    }
+    return length;
+}
+
+/// Writes the characters of the human readable type name to `out`, without the terminating zero.
+/// Memory is allocated only on the first call for each type, see pretty_name_cstr().
+/// \return Output iterator to the element past the last character written.
+template <class TypeIndex, class OutputIt>
+inline OutputIt pretty_name_to(const TypeIndex& ti, OutputIt out) {
+    for (const char* name = boost::typeindex::pretty_name_cstr(ti); *name; ++name) {
+        *out = *name;
+        ++out;
+    }
+    return out;
+}
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_PRETTY_NAME_CSTR_HPP
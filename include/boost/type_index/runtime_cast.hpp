@@ -22,6 +22,10 @@
 #include <boost/type_index/runtime_cast/register_runtime_class.hpp>
 #include <boost/type_index/runtime_cast/pointer_cast.hpp>
 #include <boost/type_index/runtime_cast/reference_cast.hpp>
+#include <boost/type_index/runtime_cast/runtime_cast_cache.hpp>
+#include <boost/type_index/runtime_cast/runtime_cast_filter.hpp>
+#include <boost/type_index/runtime_cast/runtime_is.hpp>
+#include <boost/type_index/runtime_cast/runtime_visit.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
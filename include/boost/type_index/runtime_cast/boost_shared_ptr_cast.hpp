@@ -10,7 +10,7 @@
 #define BOOST_TYPE_INDEX_RUNTIME_CAST_BOOST_SHARED_PTR_CAST_HPP
 
 /// \file boost_shared_ptr_cast.hpp
-/// \brief Contains the overload of boost::typeindex::runtime_pointer_cast for
+/// \brief Contains the overloads of boost::typeindex::runtime_pointer_cast for
 /// boost::shared_ptr types.
 
 #include <boost/type_index/detail/config.hpp>
@@ -22,6 +22,7 @@
 #if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
 #ifndef BOOST_TYPE_INDEX_USE_IMPORT_STD
 #include <type_traits>
+#include <utility>
 #endif
 #endif
 
@@ -51,6 +52,25 @@ auto runtime_pointer_cast(SmartPointer<U> const& u) -> decltype(u.use_count(), S
     return SmartPointer<T>();
 }
 
+/// \brief Creates a new instance of smart pointer whose stored pointer is obtained from u's
+/// stored pointer using a runtime_cast, taking the ownership from u.
+///
+/// On success u becomes empty and the new shared_ptr owns what u owned without changing
+/// the reference counter. If the runtime_cast performed by runtime_pointer_cast returns a null pointer,
+/// u is not modified.
+/// \tparam T The desired target type to return a pointer of.
+/// \tparam U A complete class type of the source instance pointed to from u.
+/// \return If there exists a valid conversion from U* to T*, returns a boost::shared_ptr<T>
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns boost::shared_ptr<T>();
+template<typename T, typename U,  template <class> class SmartPointer>
+auto runtime_pointer_cast(SmartPointer<U>&& u) -> decltype(u.use_count(), SmartPointer<T>()) {
+    T* value = detail::runtime_cast_impl<T>(u.get(), std::is_base_of<T, U>());
+    if(value)
+        return SmartPointer<T>(std::move(u), value);
+    return SmartPointer<T>();
+}
+
 BOOST_TYPE_INDEX_END_MODULE_EXPORT
 
 }} // namespace boost::typeindex
@@ -18,9 +18,26 @@
 /// desire opt in functionality instead of enabling it system wide.
 
 #include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast/register_runtime_class.hpp>
+
+// Caches of the runtime_cast results are keyed by the virtual table pointer, that is
+// read from the start of the source object. Only the Itanium C++ ABI guarantees
+// that a polymorphic object starts with it, other ABIs (for example the MSVC one)
+// may place a pointer to the table of virtual bases there. On such platforms
+// the caches are not used and each cast searches through the bases.
+#if defined(__GXX_ABI_VERSION) && !defined(_MSC_VER)
+#   define BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_VTABLE_KEY
+#endif
+
+#if defined(BOOST_TYPE_INDEX_RUNTIME_CAST_MEMOIZE) && defined(BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_VTABLE_KEY)
+#include <boost/type_index/runtime_cast/detail/runtime_cast_memo.hpp>
+#endif
 
 #if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
 #ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 #endif
 #endif
@@ -43,16 +60,92 @@ T const* runtime_cast_impl(U const* u, std::integral_constant<bool, true>) noexc
     return u;
 }
 
+// Marks the casts that have no result in the caches of runtime_cast results
+constexpr std::ptrdiff_t runtime_cast_not_found = PTRDIFF_MIN;
+
+#ifdef BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_VTABLE_KEY
+
+// Address of the virtual table of the `u` subobject. Virtual table identifies the
+// most derived type of the object and the position of the subobject in it, so
+// the result of boost_type_index_find_instance_ is the same for all the objects
+// with the same virtual table.
+template <class U>
+inline const void* runtime_cast_vtable(const U* u) noexcept {
+    static_assert(std::is_polymorphic<U>::value, "runtime_cast requires a polymorphic source type");
+    const void* vtable;
+    std::memcpy(&vtable, static_cast<const void*>(u), sizeof(vtable));
+    return vtable;
+}
+
+#endif
+
+// Instance of a final class could only be the most derived object, so
+// there is no need to search through the bases for it. BOOST_CXX_VERSION is
+// missing in older Boost.Config, so the library feature macro is checked first.
+template <class T>
+struct runtime_cast_is_leaf
+#if defined(__cpp_lib_is_final) || BOOST_CXX_VERSION >= 201402L
+    : std::is_final<T>
+#else
+    : std::integral_constant<bool, false>
+#endif
+{};
+
 template<typename T, typename U>
-T* runtime_cast_impl(U* u, std::integral_constant<bool, false>) noexcept {
-    return const_cast<T*>(static_cast<T const*>(
-        u->boost_type_index_find_instance_(boost::typeindex::type_id<T>())
-    ));
+T const* runtime_cast_search(U const* u, std::integral_constant<bool, true>) noexcept {
+    return static_cast<T const*>(u->boost_type_index_find_exact_(detail::runtime_class_fingerprint_of<T>()));
+}
+
+template<typename T, typename U>
+T const* runtime_cast_search(U const* u, std::integral_constant<bool, false>) noexcept {
+    return static_cast<T const*>(u->boost_type_index_find_instance_(detail::runtime_class_fingerprint_of<T>()));
+}
+
+template<typename T, typename U>
+T const* runtime_cast_resolve(U const* u) noexcept {
+    if (runtime_cast_is_leaf<T>::value) {
+        return detail::runtime_cast_search<T>(u, std::integral_constant<bool, true>());
+    }
+
+#if defined(BOOST_TYPE_INDEX_RUNTIME_CAST_MEMOIZE) && defined(BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_VTABLE_KEY)
+    runtime_cast_memo<std::ptrdiff_t>& memo = detail::runtime_cast_memo_instance<typename std::remove_cv<T>::type, std::ptrdiff_t>();
+    const void* const vtable = detail::runtime_cast_vtable(u);
+    const char* const source = reinterpret_cast<const char*>(u);
+    std::ptrdiff_t offset;
+    if (memo.find(vtable, offset)) {
+        return offset == runtime_cast_not_found ? nullptr : reinterpret_cast<T const*>(source + offset);
+    }
+
+    T const* result = detail::runtime_cast_search<T>(u, std::integral_constant<bool, false>());
+    memo.insert(vtable, result ? reinterpret_cast<const char*>(result) - source : runtime_cast_not_found);
+    return result;
+#else
+    return detail::runtime_cast_search<T>(u, std::integral_constant<bool, false>());
+#endif
 }
 
 template<typename T, typename U>
 T const* runtime_cast_impl(U const* u, std::integral_constant<bool, false>) noexcept {
-    return static_cast<T const*>(u->boost_type_index_find_instance_(boost::typeindex::type_id<T>()));
+#ifdef BOOST_TYPE_INDEX_RUNTIME_CAST_STATS
+    detail::runtime_cast_stats_visited() = 0;
+    T const* result = detail::runtime_cast_resolve<T>(u);
+    const runtime_cast_stats_key key = {
+        &boost::typeindex::type_id<U>().type_info(),
+        &boost::typeindex::type_id<T>().type_info(),
+        &u->boost_type_index_dynamic_type_()
+    };
+    detail::runtime_cast_stats_record(key, !!result, detail::runtime_cast_stats_visited());
+    return result;
+#else
+    return detail::runtime_cast_resolve<T>(u);
+#endif
+}
+
+template<typename T, typename U>
+T* runtime_cast_impl(U* u, std::integral_constant<bool, false>) noexcept {
+    return const_cast<T*>(
+        detail::runtime_cast_impl<T>(static_cast<U const*>(u), std::integral_constant<bool, false>())
+    );
 }
 
 } // namespace detail
@@ -0,0 +1,42 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CAST_MEMO_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CAST_MEMO_HPP
+
+/// \file runtime_cast_memo.hpp
+/// \brief Contains the process wide tables of runtime_cast and runtime_visit results.
+/// Tables for runtime_cast are used if BOOST_TYPE_INDEX_RUNTIME_CAST_MEMOIZE is defined.
+/// Not intended for inclusion from user's code.
+
+#include <boost/type_index/detail/config.hpp>
+#include <boost/type_index/detail/lock_free_map.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+// Maps virtual tables of the source subobjects to the results of the casts,
+// for example to the offsets of the runtime_cast results for a single target
+// type.
+template <class Value>
+using runtime_cast_memo = lock_free_map<const void*, Value>;
+
+// One table per Tag, for example per target type of runtime_cast. The table is
+// never destroyed, so that casts remain usable in destructors of static objects.
+template <class Tag, class Value>
+inline runtime_cast_memo<Value>& runtime_cast_memo_instance() noexcept {
+    static runtime_cast_memo<Value>* const instance = new runtime_cast_memo<Value>();
+    return *instance;
+}
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CAST_MEMO_HPP
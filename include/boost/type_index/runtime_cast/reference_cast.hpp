@@ -23,6 +23,11 @@
 #ifndef BOOST_TYPE_INDEX_USE_IMPORT_STD
 #include <memory>
 #include <type_traits>
+
+#ifndef BOOST_NO_CXX17_HDR_OPTIONAL
+#include <functional>
+#include <optional>
+#endif
 #endif
 
 #include <boost/throw_exception.hpp>
@@ -71,6 +76,44 @@ typename std::add_lvalue_reference<const T>::type runtime_cast(U const& u) {
     return *value;
 }
 
+#if !defined(BOOST_NO_CXX17_HDR_OPTIONAL) || defined(BOOST_TYPE_INDEX_DOXYGEN_INVOKED)
+
+/// \brief Same as boost::typeindex::runtime_cast(U& u), but reports the failure by returning an empty optional
+/// instead of throwing. Does not allocate and does not throw, so it is suitable for the code where a failed
+/// cast is an expected outcome.
+///
+/// Available if the standard library provides std::optional.
+/// \tparam T The desired target type. Must be a complete class type.
+/// \tparam U A complete class type of the source instance, u.
+/// \return If there exists a valid conversion from U& to T&, returns a reference to an address suitably offset
+/// from u. If no such conversion exists, returns an empty optional.
+template<typename T, typename U>
+std::optional<std::reference_wrapper<T> > try_runtime_reference_cast(U& u) noexcept {
+    T* value = detail::runtime_cast_impl<T>(std::addressof(u), std::is_base_of<T, U>());
+    if(!value)
+        return std::nullopt;
+    return std::ref(*value);
+}
+
+/// \brief Same as boost::typeindex::runtime_cast(U const& u), but reports the failure by returning an empty optional
+/// instead of throwing. Does not allocate and does not throw, so it is suitable for the code where a failed
+/// cast is an expected outcome.
+///
+/// Available if the standard library provides std::optional.
+/// \tparam T The desired target type. Must be a complete class type.
+/// \tparam U A complete class type of the source instance, u.
+/// \return If there exists a valid conversion from U const& to T const&, returns a reference to an address
+/// suitably offset from u. If no such conversion exists, returns an empty optional.
+template<typename T, typename U>
+std::optional<std::reference_wrapper<const T> > try_runtime_reference_cast(U const& u) noexcept {
+    const T* value = detail::runtime_cast_impl<T>(std::addressof(u), std::is_base_of<T, U>());
+    if(!value)
+        return std::nullopt;
+    return std::cref(*value);
+}
+
+#endif
+
 BOOST_TYPE_INDEX_END_MODULE_EXPORT
 
 }} // namespace boost::typeindex
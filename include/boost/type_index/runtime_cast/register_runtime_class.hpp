@@ -17,8 +17,18 @@
 
 #include <boost/type_index.hpp>
 
+#ifdef BOOST_TYPE_INDEX_RUNTIME_CAST_STATS
+#include <boost/type_index/runtime_cast/runtime_cast_stats.hpp>
+#endif
+
 #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
 
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#endif
+#endif
+
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
 #endif
@@ -46,6 +56,244 @@ const void* find_instance(boost::typeindex::type_index const& idx, const Self* s
     return boost::typeindex::detail::find_instance<OtherBases...>(idx, self);
 }
 
+template <class... T>
+struct runtime_class_list {};
+
+// Identity of the type that is searched for in the bases: the type_info and
+// its hash_code(). Comparison of the hashes rejects the other types without
+// touching their names, even if the type_info instances are duplicated in
+// different shared libraries.
+struct runtime_class_fingerprint {
+    runtime_class_fingerprint(boost::typeindex::type_index const& idx) noexcept
+        : type_(&idx.type_info())
+        , hash_(idx.hash_code())
+    {}
+
+    const type_index::type_info_t* type_;
+    std::size_t hash_;
+};
+
+// Fingerprint of T is computed once, so the casts do not compute hash_code()
+template <class T>
+inline const runtime_class_fingerprint& runtime_class_fingerprint_of() noexcept {
+    static const runtime_class_fingerprint fingerprint(boost::typeindex::type_id<T>());
+    return fingerprint;
+}
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+// Path from a class to one of its ancestors through the direct bases
+template <class Path>
+struct runtime_class_path;
+
+template <class Last>
+struct runtime_class_path<runtime_class_list<Last> > {
+    using target = Last;
+
+    static const void* cast(const Last* p) noexcept {
+        return p;
+    }
+};
+
+template <class From, class To, class... Rest>
+struct runtime_class_path<runtime_class_list<From, To, Rest...> > {
+    using next = runtime_class_path<runtime_class_list<To, Rest...> >;
+    using target = typename next::target;
+
+    static const void* cast(const From* p) noexcept {
+        return next::cast(p);
+    }
+};
+
+template <class First, class... Rest>
+const void* runtime_class_path_cast(const void* self) noexcept {
+    return runtime_class_path<runtime_class_list<First, Rest...> >::cast(static_cast<const First*>(self));
+}
+
+template <class... Lists>
+struct runtime_class_concat;
+
+template <>
+struct runtime_class_concat<> {
+    using type = runtime_class_list<>;
+};
+
+template <class... A>
+struct runtime_class_concat<runtime_class_list<A...> > {
+    using type = runtime_class_list<A...>;
+};
+
+template <class... A, class... B, class... Rest>
+struct runtime_class_concat<runtime_class_list<A...>, runtime_class_list<B...>, Rest...>
+    : runtime_class_concat<runtime_class_list<A..., B...>, Rest...>
+{};
+
+template <class T, class Paths>
+struct runtime_class_prepend;
+
+template <class T, class... Paths>
+struct runtime_class_prepend<T, runtime_class_list<Paths...> > {
+    using type = runtime_class_list<typename runtime_class_concat<runtime_class_list<T>, Paths>::type...>;
+};
+
+// Paths to all the ancestors of Class in the order of a depth first walk
+// through the bases, starting from the Class itself
+template <class Class, class Bases = typename Class::boost_type_index_bases_>
+struct runtime_class_ancestors;
+
+template <class Class, class... Bases>
+struct runtime_class_ancestors<Class, runtime_class_list<Bases...> > {
+    using type = typename runtime_class_concat<
+        runtime_class_list<runtime_class_list<Class> >,
+        typename runtime_class_prepend<Class, typename runtime_class_ancestors<Bases>::type>::type...
+    >::type;
+};
+
+template <class Path>
+struct runtime_class_entry;
+
+template <class... Path>
+struct runtime_class_entry<runtime_class_list<Path...> > {
+    static const type_index::type_info_t& type_info() noexcept {
+        return boost::typeindex::type_id<typename runtime_class_path<runtime_class_list<Path...> >::target>().type_info();
+    }
+
+    static const void* cast(const void* self) noexcept {
+        return runtime_class_path_cast<Path...>(self);
+    }
+};
+
+// Table of all the ancestors of a class. Each column is a contiguous array
+// to make the scans fast.
+template <std::size_t Size>
+struct runtime_class_table_data {
+    const type_index::type_info_t* types_[Size];
+    std::size_t hashes_[Size];
+    const void* (*casts_[Size])(const void*);
+};
+
+template <class Paths>
+struct runtime_class_table;
+
+template <class... Paths>
+struct runtime_class_table<runtime_class_list<Paths...> > {
+    static constexpr std::size_t size = sizeof...(Paths);
+
+    static const runtime_class_table_data<size>& data() noexcept {
+        static const runtime_class_table_data<size> table = make();
+        return table;
+    }
+
+private:
+    static runtime_class_table_data<size> make() noexcept {
+        runtime_class_table_data<size> table = {
+            { &runtime_class_entry<Paths>::type_info()... },
+            { type_index(runtime_class_entry<Paths>::type_info()).hash_code()... },
+            { &runtime_class_entry<Paths>::cast... }
+        };
+        return table;
+    }
+};
+
+template <std::size_t Size>
+bool runtime_class_table_match(const runtime_class_table_data<Size>& data, std::size_t i, const runtime_class_fingerprint& fp) noexcept {
+    return data.hashes_[i] == fp.hash_ && (data.types_[i] == fp.type_ || type_index(*data.types_[i]) == type_index(*fp.type_));
+}
+
+// Index of the first entry of the table with the type `fp` or Size if there is no such
+// entry. Types are compared by precomputed hashes, and only the types with equal hashes are
+// compared by the addresses of their type_info and by names.
+template <std::size_t Size>
+std::size_t runtime_class_table_find(const runtime_class_table_data<Size>& data, const runtime_class_fingerprint& fp) noexcept {
+    // Entry 0 is the dynamic type itself, checks for it are the most common ones
+    if (data.types_[0] == fp.type_) {
+        return 0;
+    }
+
+    for (std::size_t i = 0; i < Size; ++i) {
+        if (detail::runtime_class_table_match(data, i, fp)) {
+            return i;
+        }
+    }
+
+    return Size;
+}
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+// Scans the flattened table of all the ancestors of Self, so that a single
+// virtual call is required to find an instance of the requested type.
+template <class Self>
+const void* find_instance_in_ancestors(const runtime_class_fingerprint& fp, const Self* self) noexcept {
+    using table = runtime_class_table<typename runtime_class_ancestors<Self>::type>;
+    const runtime_class_table_data<table::size>& data = table::data();
+
+    const std::size_t i = detail::runtime_class_table_find(data, fp);
+#ifdef BOOST_TYPE_INDEX_RUNTIME_CAST_STATS
+    detail::runtime_cast_stats_visited() = (i < table::size ? i + 1 : table::size);
+#endif
+    if (i == 0) {
+        return self;
+    }
+    if (i >= table::size) {
+        return nullptr;
+    }
+    return data.casts_[i](self);
+}
+
+// Same as find_instance_in_ancestors, but checks only the Self type. Used for
+// the casts to final classes, because an instance of a final class could only
+// be the most derived object.
+template <class Self>
+const void* find_exact_instance(const runtime_class_fingerprint& fp, const Self* self) noexcept {
+    using table = runtime_class_table<typename runtime_class_ancestors<Self>::type>;
+    const runtime_class_table_data<table::size>& data = table::data();
+#ifdef BOOST_TYPE_INDEX_RUNTIME_CAST_STATS
+    detail::runtime_cast_stats_visited() = 1;
+#endif
+    return (data.types_[0] == fp.type_ || detail::runtime_class_table_match(data, 0, fp)) ? self : nullptr;
+}
+
+template <class Self>
+const type_index::type_info_t& runtime_class_type_info(const Self*) noexcept {
+    return boost::typeindex::type_id<Self>().type_info();
+}
+
+// Finds the first of the `count` types from `fps` that is an ancestor of Self in a single
+// scan of the table. Sets `index` to the position of that type in `fps` or to `count` if
+// there is no such type, and returns the address of the instance of that type.
+template <class Self>
+const void* find_first_instance_in_ancestors(const runtime_class_fingerprint* const* fps, std::size_t count,
+        std::size_t& index, const Self* self) noexcept
+{
+    using table = runtime_class_table<typename runtime_class_ancestors<Self>::type>;
+    const runtime_class_table_data<table::size>& data = table::data();
+
+    index = count;
+    std::size_t entry = table::size;
+    for (std::size_t i = 0; i < table::size && index; ++i) {
+        for (std::size_t j = 0; j < index; ++j) {
+            if (detail::runtime_class_table_match(data, i, *fps[j])) {
+                index = j;
+                entry = i;
+                break;
+            }
+        }
+    }
+
+    if (entry == 0) {
+        return self;
+    }
+    return entry == table::size ? nullptr : data.casts_[entry](self);
+}
+
+// Same as find_instance_in_ancestors, but does not compute the address of the instance
+template <class Self>
+bool is_instance_in_ancestors(const runtime_class_fingerprint& fp, const Self*) noexcept {
+    using table = runtime_class_table<typename runtime_class_ancestors<Self>::type>;
+    return detail::runtime_class_table_find(table::data(), fp) != table::size;
+}
+
 BOOST_TYPE_INDEX_END_MODULE_EXPORT
 
 }}} // namespace boost::typeindex::detail
@@ -53,6 +301,17 @@ BOOST_TYPE_INDEX_END_MODULE_EXPORT
 #endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
 
 
+/// \cond
+#ifdef BOOST_TYPE_INDEX_RUNTIME_CAST_STATS
+#define BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_STATS_HOOK                                                           \
+    virtual boost::typeindex::type_index::type_info_t const& boost_type_index_dynamic_type_() const noexcept {    \
+        return boost::typeindex::detail::runtime_class_type_info(this);                                           \
+    }
+#else
+#define BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_STATS_HOOK
+#endif
+/// \endcond
+
 /// \def BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS
 /// \brief Macro used to make a class compatible with boost::typeindex::runtime_cast
 ///
@@ -137,11 +396,25 @@ BOOST_TYPE_INDEX_END_MODULE_EXPORT
 /// \param base_class_seq A Boost.Preprocessor sequence of the current class' direct bases, or
 /// BOOST_TYPE_INDEX_NO_BASE_CLASS if this class has no direct base classes.
 #define BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(...)                                                              \
-    virtual void const* boost_type_index_find_instance_(boost::typeindex::type_index const& idx) const noexcept { \
-        if(idx == boost::typeindex::detail::runtime_class_construct_type_id(this))                                \
-            return this;                                                                                          \
-        return boost::typeindex::detail::find_instance<__VA_ARGS__>(idx, this);                                   \
-    }
+    using boost_type_index_bases_ = boost::typeindex::detail::runtime_class_list<__VA_ARGS__>;                   \
+    virtual void const* boost_type_index_find_instance_(                                                          \
+            boost::typeindex::detail::runtime_class_fingerprint const& fp) const noexcept {                         \
+        return boost::typeindex::detail::find_instance_in_ancestors(fp, this);                                    \
+    }                                                                                                             \
+    virtual void const* boost_type_index_find_exact_(                                                             \
+            boost::typeindex::detail::runtime_class_fingerprint const& fp) const noexcept {                         \
+        return boost::typeindex::detail::find_exact_instance(fp, this);                                           \
+    }                                                                                                             \
+    virtual bool boost_type_index_is_instance_(                                                                   \
+            boost::typeindex::detail::runtime_class_fingerprint const& fp) const noexcept {                         \
+        return boost::typeindex::detail::is_instance_in_ancestors(fp, this);                                      \
+    }                                                                                                             \
+    virtual void const* boost_type_index_find_first_(                                                             \
+            boost::typeindex::detail::runtime_class_fingerprint const* const* fps, std::size_t count,             \
+            std::size_t& index) const noexcept {                                                                  \
+        return boost::typeindex::detail::find_first_instance_in_ancestors(fps, count, index, this);               \
+    }                                                                                                             \
+    BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_STATS_HOOK
 
 /// \def BOOST_TYPE_INDEX_NO_BASE_CLASS
 /// \brief Instructs BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS and BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST
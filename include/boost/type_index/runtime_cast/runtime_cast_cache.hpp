@@ -0,0 +1,194 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_CACHE_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_CACHE_HPP
+
+/// \file runtime_cast_cache.hpp
+/// \brief Contains boost::typeindex::runtime_cast_cache class and the overloads of
+/// boost::typeindex::runtime_cast for pointer types that use it.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \class runtime_cast_cache
+/// Remembers the result of the last boost::typeindex::runtime_cast to `T` that was done with this cache:
+/// the virtual table of the source object and the offset of the result from the source pointer. Repeated
+/// casts of objects of the same dynamic type cost a comparison of pointers and a pointer addition.
+/// On a miss the usual search through the bases is done and the result is remembered.
+///
+/// Intended to be a function local static or thread_local variable at the call site:
+/// \code
+/// static boost::typeindex::runtime_cast_cache<derived> cache;
+/// derived* d = boost::typeindex::runtime_cast<derived*>(base_ptr, cache);
+/// \endcode
+///
+/// The cache is used only on platforms with the Itanium C++ ABI (GCC, Clang except clang-cl), where
+/// the virtual table pointer is at the start of each polymorphic object. On other platforms the casts with
+/// the cache are the same as the casts without it.
+///
+/// Cache is thread safe. All the classes of the hierarchy should use BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS
+/// or BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST.
+///
+/// \tparam T Target type of the casts, without pointer, const and volatile qualifiers.
+template <class T>
+class runtime_cast_cache {
+public:
+    constexpr runtime_cast_cache() noexcept = default;
+
+    runtime_cast_cache(const runtime_cast_cache&) = delete;
+    runtime_cast_cache& operator=(const runtime_cast_cache&) = delete;
+
+    /// \cond
+    // Returns true and sets `offset` if the result of the cast for `vtable` was remembered.
+    bool lookup(const void* vtable, std::ptrdiff_t& offset) const noexcept {
+        const unsigned version = version_.load(std::memory_order_acquire);
+        if (version & 1u) {
+            return false;
+        }
+
+        const void* const cached_vtable = vtable_.load(std::memory_order_relaxed);
+        offset = offset_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return cached_vtable == vtable && version_.load(std::memory_order_relaxed) == version;
+    }
+
+    // Remembers the result of the cast. Does nothing if other thread updates the cache.
+    void store(const void* vtable, std::ptrdiff_t offset) noexcept {
+        unsigned version = version_.load(std::memory_order_relaxed);
+        if ((version & 1u) || !version_.compare_exchange_strong(version, version + 1, std::memory_order_acquire)) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        vtable_.store(vtable, std::memory_order_relaxed);
+        offset_.store(offset, std::memory_order_relaxed);
+        version_.store(version + 2, std::memory_order_release);
+    }
+    /// \endcond
+
+private:
+    // Seqlock: odd version means that the cache is being updated
+    std::atomic<unsigned> version_{0};
+    std::atomic<const void*> vtable_{nullptr};
+    std::atomic<std::ptrdiff_t> offset_{0};
+};
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+namespace detail {
+
+template <class T, class U>
+T const* runtime_cast_cached_impl(U const* u, runtime_cast_cache<typename std::remove_cv<T>::type>&,
+        std::integral_constant<bool, true>) noexcept
+{
+    return u;
+}
+
+template <class T, class U>
+T const* runtime_cast_cached_impl(U const* u, runtime_cast_cache<typename std::remove_cv<T>::type>& cache,
+        std::integral_constant<bool, false>) noexcept
+{
+#ifdef BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_VTABLE_KEY
+    const void* const vtable = detail::runtime_cast_vtable(u);
+    const char* const source = reinterpret_cast<const char*>(u);
+    std::ptrdiff_t offset;
+    if (cache.lookup(vtable, offset)) {
+        return offset == detail::runtime_cast_not_found ? nullptr : reinterpret_cast<T const*>(source + offset);
+    }
+
+    T const* result = detail::runtime_cast_impl<T>(u, std::integral_constant<bool, false>());
+    cache.store(vtable, result ? reinterpret_cast<const char*>(result) - source : detail::runtime_cast_not_found);
+    return result;
+#else
+    (void)cache;
+    return detail::runtime_cast_impl<T>(u, std::integral_constant<bool, false>());
+#endif
+}
+
+} // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \brief Same as boost::typeindex::runtime_cast(U* u), but remembers the result in the `cache`
+/// and reuses it for the objects of the same dynamic type.
+/// \tparam T The desired target type. Like dynamic_cast, must be a pointer to complete class type.
+/// \tparam U A complete polymorphic class type of the source instance, u.
+/// \return If there exists a valid conversion from U* to T, returns a T that points to
+/// an address suitably offset from u. If no such conversion exists, returns nullptr.
+template<typename T, typename U>
+typename std::enable_if<!std::is_const<U>::value, T>::type
+runtime_cast(U* u, runtime_cast_cache<typename std::remove_cv<typename std::remove_pointer<T>::type>::type>& cache) noexcept {
+    using impl_type = typename std::remove_pointer<T>::type;
+    return const_cast<T>(detail::runtime_cast_cached_impl<impl_type>(u, cache, std::is_base_of<impl_type, U>()));
+}
+
+/// \brief Same as boost::typeindex::runtime_cast(U const* u), but remembers the result in the `cache`
+/// and reuses it for the objects of the same dynamic type.
+/// \tparam T The desired target type. Like dynamic_cast, must be a pointer to complete class type.
+/// \tparam U A complete polymorphic class type of the source instance, u.
+/// \return If there exists a valid conversion from U const* to T, returns a T that points to
+/// an address suitably offset from u. If no such conversion exists, returns nullptr.
+template<typename T, typename U>
+T runtime_cast(U const* u, runtime_cast_cache<typename std::remove_cv<typename std::remove_pointer<T>::type>::type>& cache) noexcept {
+    using impl_type = typename std::remove_pointer<T>::type;
+    return detail::runtime_cast_cached_impl<impl_type>(u, cache, std::is_base_of<impl_type, U>());
+}
+
+/// \brief Same as boost::typeindex::runtime_pointer_cast(U* u), but remembers the result in the `cache`
+/// and reuses it for the objects of the same dynamic type.
+/// \tparam T The desired target type to return a pointer to.
+/// \tparam U A complete polymorphic class type of the source instance, u.
+/// \return If there exists a valid conversion from U* to T*, returns a T*
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns nullptr.
+template<typename T, typename U>
+typename std::enable_if<!std::is_const<U>::value, T*>::type
+runtime_pointer_cast(U* u, runtime_cast_cache<typename std::remove_cv<T>::type>& cache) noexcept {
+    return const_cast<T*>(detail::runtime_cast_cached_impl<T>(u, cache, std::is_base_of<T, U>()));
+}
+
+/// \brief Same as boost::typeindex::runtime_pointer_cast(U const* u), but remembers the result in the `cache`
+/// and reuses it for the objects of the same dynamic type.
+/// \tparam T The desired target type to return a pointer to.
+/// \tparam U A complete polymorphic class type of the source instance, u.
+/// \return If there exists a valid conversion from U const* to T const*, returns a T const*
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns nullptr.
+template<typename T, typename U>
+T const* runtime_pointer_cast(U const* u, runtime_cast_cache<typename std::remove_cv<T>::type>& cache) noexcept {
+    return detail::runtime_cast_cached_impl<T>(u, cache, std::is_base_of<T, U>());
+}
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_CACHE_HPP
@@ -0,0 +1,184 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_FILTER_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_FILTER_HPP
+
+/// \file runtime_cast_filter.hpp
+/// \brief Contains boost::typeindex::runtime_cast_filter function that applies
+/// boost::typeindex::runtime_cast to a range of pointers.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
+
+#if !defined(__GNUC__) && !defined(__clang__) && defined(_MSC_VER) \
+    && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_MM_PREFETCH
+#endif
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#endif
+
+#ifdef BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_MM_PREFETCH
+#include <emmintrin.h>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+namespace detail {
+
+// How many elements ahead of the current one the objects are prefetched
+constexpr std::size_t runtime_cast_prefetch_distance = 8;
+
+inline void runtime_cast_prefetch(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#elif defined(BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_MM_PREFETCH)
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+// Results of the casts for the recently seen virtual tables. Direct mapped,
+// so that a lookup is a single comparison. Lives on the stack for the duration
+// of a single call of runtime_cast_filter.
+template <class T>
+class runtime_cast_batch {
+public:
+    template <class U>
+    T const* cast(U const* u) noexcept {
+#ifndef BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_VTABLE_KEY
+        return detail::runtime_cast_impl<T>(u, std::integral_constant<bool, false>());
+#else
+        const void* const vtable = detail::runtime_cast_vtable(u);
+        const std::uintptr_t bits = reinterpret_cast<std::uintptr_t>(vtable);
+        entry_type& e = entries_[((bits >> 3) ^ (bits >> 9)) % size];
+
+        const char* const source = reinterpret_cast<const char*>(u);
+        if (e.vtable_ != vtable) {
+            T const* result = detail::runtime_cast_impl<T>(u, std::integral_constant<bool, false>());
+            e.vtable_ = vtable;
+            e.offset_ = result ? reinterpret_cast<const char*>(result) - source : detail::runtime_cast_not_found;
+            return result;
+        }
+        return e.offset_ == detail::runtime_cast_not_found ? nullptr : reinterpret_cast<T const*>(source + e.offset_);
+#endif
+    }
+
+private:
+    static constexpr std::size_t size = 16;
+
+    struct entry_type {
+        const void* vtable_ = nullptr;
+        std::ptrdiff_t offset_ = 0;
+    };
+
+    entry_type entries_[size];
+};
+
+template <class T, class U, class ForwardIt, class OutputIt>
+OutputIt runtime_cast_filter_impl(ForwardIt first, ForwardIt last, OutputIt out, std::integral_constant<bool, true>) {
+    for (; first != last; ++first) {
+        if (U* const u = *first) {
+            *out = static_cast<T*>(u);
+            ++out;
+        }
+    }
+    return out;
+}
+
+template <class T, class U, class ForwardIt, class OutputIt>
+OutputIt runtime_cast_filter_impl(ForwardIt first, ForwardIt last, OutputIt out, std::integral_constant<bool, false>) {
+    runtime_cast_batch<typename std::remove_cv<T>::type> batch;
+
+    ForwardIt ahead = first;
+    for (std::size_t i = 0; i < runtime_cast_prefetch_distance && ahead != last; ++i, ++ahead) {
+        if (U* const u = *ahead) {
+            detail::runtime_cast_prefetch(u);
+        }
+    }
+
+    for (; first != last; ++first) {
+        if (ahead != last) {
+            if (U* const u = *ahead) {
+                detail::runtime_cast_prefetch(u);
+            }
+            ++ahead;
+        }
+
+        U* const u = *first;
+        if (!u) {
+            continue;
+        }
+        if (T* const result = const_cast<T*>(batch.cast(u))) {
+            *out = result;
+            ++out;
+        }
+    }
+    return out;
+}
+
+} // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \brief Writes the results of boost::typeindex::runtime_cast of each pointer from the range
+/// [first, last) to `out`, skipping the null results. Order of the elements is preserved.
+///
+/// Faster than a loop with runtime_cast for large ranges: the objects are prefetched ahead of the current
+/// element and the result of the search through the bases is reused for all the objects of the same dynamic
+/// type, so usually each distinct dynamic type is resolved only once.
+///
+/// \b Example:
+/// \code
+/// std::vector<shape*> shapes = ...;
+/// std::vector<circle*> circles;
+/// boost::typeindex::runtime_cast_filter<circle>(shapes.begin(), shapes.end(), std::back_inserter(circles));
+/// \endcode
+///
+/// \tparam T The desired target type to return a pointer to. Must be a complete class type.
+/// \tparam ForwardIt Forward iterator with the value type U* where U is a complete polymorphic class type.
+/// Null pointers are skipped.
+/// \tparam OutputIt Output iterator that accepts T* (or T const* if U is const).
+/// \return Output iterator to the element past the last element written.
+template <class T, class ForwardIt, class OutputIt>
+OutputIt runtime_cast_filter(ForwardIt first, ForwardIt last, OutputIt out) {
+    using pointer = typename std::iterator_traits<ForwardIt>::value_type;
+    static_assert(std::is_pointer<pointer>::value, "runtime_cast_filter requires a range of pointers");
+
+    using source_type = typename std::remove_pointer<pointer>::type;
+    using target_type = typename std::conditional<
+        std::is_const<source_type>::value, const T, T
+    >::type;
+    return detail::runtime_cast_filter_impl<target_type, source_type>(
+        first, last, out, std::is_base_of<typename std::remove_cv<T>::type, typename std::remove_cv<source_type>::type>()
+    );
+}
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_FILTER_HPP
@@ -0,0 +1,253 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_STATS_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_STATS_HPP
+
+/// \file runtime_cast_stats.hpp
+/// \brief Contains boost::typeindex::runtime_cast_stats_snapshot and boost::typeindex::runtime_cast_stats_reset
+/// functions that report the counters of boost::typeindex::runtime_cast calls.
+/// Counters are collected only if BOOST_TYPE_INDEX_RUNTIME_CAST_STATS is defined.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// Counters of boost::typeindex::runtime_cast calls for a single combination of the static type of the source
+/// pointer, the target type and the dynamic type of the source object.
+struct runtime_cast_stats_entry {
+    std::string source;         ///< pretty_name() of the static type of the source pointer
+    std::string target;         ///< pretty_name() of the target type
+    std::string dynamic_type;   ///< pretty_name() of the dynamic type of the source object
+    std::uint64_t calls;        ///< count of the casts
+    std::uint64_t successes;    ///< count of the casts that returned a non null pointer
+    std::uint64_t failures;     ///< count of the casts that returned a null pointer
+    std::uint64_t visited;      ///< total count of the ancestors of the dynamic type that were checked by the casts
+};
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+namespace detail {
+
+struct runtime_cast_stats_key {
+    const type_index::type_info_t* source_;
+    const type_index::type_info_t* target_;
+    const type_index::type_info_t* dynamic_;
+
+    bool operator==(const runtime_cast_stats_key& other) const noexcept {
+        return source_ == other.source_ && target_ == other.target_ && dynamic_ == other.dynamic_;
+    }
+};
+
+struct runtime_cast_stats_key_hash {
+    std::size_t operator()(const runtime_cast_stats_key& key) const noexcept {
+        std::size_t h = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(key.source_));
+        h = h * 31 + static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(key.target_));
+        return h * 31 + static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(key.dynamic_));
+    }
+};
+
+// Same as runtime_cast_stats_key, but the types are compared by type_index, so that the
+// counters of the same types from different shared libraries are merged in the snapshots
+struct runtime_cast_stats_snapshot_key {
+    type_index source_;
+    type_index target_;
+    type_index dynamic_;
+
+    bool operator==(const runtime_cast_stats_snapshot_key& other) const noexcept {
+        return source_ == other.source_ && target_ == other.target_ && dynamic_ == other.dynamic_;
+    }
+};
+
+struct runtime_cast_stats_snapshot_key_hash {
+    std::size_t operator()(const runtime_cast_stats_snapshot_key& key) const noexcept {
+        std::size_t h = key.source_.hash_code();
+        h = h * 31 + key.target_.hash_code();
+        return h * 31 + key.dynamic_.hash_code();
+    }
+};
+
+struct runtime_cast_stats_counters {
+    std::uint64_t calls_ = 0;
+    std::uint64_t successes_ = 0;
+    std::uint64_t visited_ = 0;
+};
+
+// Counters of a single thread. Mutex is locked by the owning thread on each
+// cast and by the snapshots, so it is almost never contended.
+struct runtime_cast_stats_shard {
+    std::mutex mutex_;
+    std::unordered_map<runtime_cast_stats_key, runtime_cast_stats_counters, runtime_cast_stats_key_hash> counters_;
+};
+
+// Shards of all the threads that ever did a cast. Shards outlive their
+// threads, so the counters of finished threads stay in the snapshots.
+class runtime_cast_stats_registry {
+public:
+    runtime_cast_stats_shard* add() {
+        std::unique_ptr<runtime_cast_stats_shard> shard(new runtime_cast_stats_shard());
+        std::lock_guard<std::mutex> lock(mutex_);
+        shards_.push_back(std::move(shard));
+        return shards_.back().get();
+    }
+
+    template <class F>
+    void for_each(F f) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& shard : shards_) {
+            std::lock_guard<std::mutex> shard_lock(shard->mutex_);
+            f(*shard);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<runtime_cast_stats_shard> > shards_;
+};
+
+// Never destroyed, so that casts remain usable in destructors of static objects
+BOOST_SYMBOL_VISIBLE inline runtime_cast_stats_registry& runtime_cast_stats_registry_instance() {
+    static runtime_cast_stats_registry* const instance = new runtime_cast_stats_registry();
+    return *instance;
+}
+
+inline runtime_cast_stats_shard& runtime_cast_stats_local_shard() {
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    static thread_local runtime_cast_stats_shard* const shard = runtime_cast_stats_registry_instance().add();
+#else
+    static runtime_cast_stats_shard* const shard = runtime_cast_stats_registry_instance().add();
+#endif
+    return *shard;
+}
+
+// Count of the ancestors checked by the last search through the bases in this thread
+inline std::size_t& runtime_cast_stats_visited() noexcept {
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    static thread_local std::size_t visited = 0;
+#else
+    static std::size_t visited = 0;
+#endif
+    return visited;
+}
+
+// Silently does nothing if there is not enough memory
+inline void runtime_cast_stats_record(const runtime_cast_stats_key& key, bool success, std::size_t visited) noexcept {
+#ifndef BOOST_NO_EXCEPTIONS
+    try {
+#endif
+        runtime_cast_stats_shard& shard = detail::runtime_cast_stats_local_shard();
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        runtime_cast_stats_counters& counters = shard.counters_[key];
+        ++counters.calls_;
+        counters.successes_ += success;
+        counters.visited_ += visited;
+#ifndef BOOST_NO_EXCEPTIONS
+    } catch (...) {
+    }
+#endif
+}
+
+} // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// Returns the counters of all the boost::typeindex::runtime_cast calls that were done in all the threads
+/// since the start of the program or since the last runtime_cast_stats_reset() call, sorted by the count
+/// of calls in descending order. Counters of the casts from different shared libraries are merged if
+/// the types compare equal as boost::typeindex::type_index.
+///
+/// Counters are collected only in the code that is compiled with BOOST_TYPE_INDEX_RUNTIME_CAST_STATS defined.
+/// Counted are the calls of boost::typeindex::runtime_cast and boost::typeindex::runtime_pointer_cast, including
+/// the ones resolved by BOOST_TYPE_INDEX_RUNTIME_CAST_MEMOIZE (with zero visited ancestors). Casts that were resolved
+/// by boost::typeindex::runtime_cast_cache, boost::typeindex::runtime_cast_filter or boost::typeindex::runtime_visit
+/// without a search through the bases and the checks of boost::typeindex::runtime_is are not counted.
+///
+/// \b Example:
+/// \code
+/// for (const auto& e : boost::typeindex::runtime_cast_stats_snapshot()) {
+///     std::cout << e.source << " -> " << e.target << " (object of " << e.dynamic_type << "): "
+///               << e.calls << " calls, " << e.failures << " failed\n";
+/// }
+/// \endcode
+///
+/// \throw std::bad_alloc or std::system_error if a mutex could not be locked.
+inline std::vector<runtime_cast_stats_entry> runtime_cast_stats_snapshot() {
+    using key_type = detail::runtime_cast_stats_snapshot_key;
+    using counters_type = detail::runtime_cast_stats_counters;
+    std::unordered_map<key_type, counters_type, detail::runtime_cast_stats_snapshot_key_hash> total;
+    detail::runtime_cast_stats_registry_instance().for_each([&total](const detail::runtime_cast_stats_shard& shard) {
+        for (const auto& v : shard.counters_) {
+            const key_type key{
+                type_index(*v.first.source_), type_index(*v.first.target_), type_index(*v.first.dynamic_)
+            };
+            counters_type& counters = total[key];
+            counters.calls_ += v.second.calls_;
+            counters.successes_ += v.second.successes_;
+            counters.visited_ += v.second.visited_;
+        }
+    });
+
+    std::vector<runtime_cast_stats_entry> result;
+    result.reserve(total.size());
+    for (const auto& v : total) {
+        runtime_cast_stats_entry entry;
+        entry.source = v.first.source_.pretty_name();
+        entry.target = v.first.target_.pretty_name();
+        entry.dynamic_type = v.first.dynamic_.pretty_name();
+        entry.calls = v.second.calls_;
+        entry.successes = v.second.successes_;
+        entry.failures = v.second.calls_ - v.second.successes_;
+        entry.visited = v.second.visited_;
+        result.push_back(std::move(entry));
+    }
+
+    std::sort(result.begin(), result.end(), [](const runtime_cast_stats_entry& lhs, const runtime_cast_stats_entry& rhs) {
+        return lhs.calls > rhs.calls;
+    });
+    return result;
+}
+
+/// Sets all the counters of boost::typeindex::runtime_cast calls to zero.
+///
+/// \throw std::system_error if a mutex could not be locked.
+inline void runtime_cast_stats_reset() {
+    detail::runtime_cast_stats_registry_instance().for_each([](detail::runtime_cast_stats_shard& shard) {
+        shard.counters_.clear();
+    });
+}
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_CAST_STATS_HPP
@@ -0,0 +1,86 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_IS_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_IS_HPP
+
+/// \file runtime_is.hpp
+/// \brief Contains the function overloads of boost::typeindex::runtime_is that check
+/// if an object could be converted to a type with boost::typeindex::runtime_cast.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <type_traits>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+namespace detail {
+
+template<typename T, typename U>
+constexpr bool runtime_is_impl(U const&, std::integral_constant<bool, true>) noexcept {
+    return true;
+}
+
+template<typename T, typename U>
+bool runtime_is_impl(U const& u, std::integral_constant<bool, false>) noexcept {
+    if (runtime_cast_is_leaf<T>::value) {
+        return !!u.boost_type_index_find_exact_(detail::runtime_class_fingerprint_of<T>());
+    }
+    return u.boost_type_index_is_instance_(detail::runtime_class_fingerprint_of<T>());
+}
+
+} // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \brief Checks if the object is an instance of `T`, same as `boost::typeindex::runtime_cast<T const*>(u) != nullptr`
+/// but without computing the address of the `T` subobject.
+///
+/// The dynamic type of the object is checked first, then all the other bases are checked.
+/// \tparam T The type to check for. Must be a complete class type, cv-qualifiers are ignored.
+/// \tparam U A complete class type of the source instance, u.
+/// \return true if u is not null and there exists a valid conversion from U const* to T const*.
+template<typename T, typename U>
+bool runtime_is(U const* u) noexcept {
+    using impl_type = typename std::remove_cv<T>::type;
+    return u && detail::runtime_is_impl<impl_type>(*u, std::is_base_of<impl_type, U>());
+}
+
+/// \brief Checks if the object is an instance of `T`, same as `boost::typeindex::runtime_cast<T const*>(&u) != nullptr`
+/// but without computing the address of the `T` subobject.
+///
+/// The dynamic type of the object is checked first, then all the other bases are checked.
+/// \tparam T The type to check for. Must be a complete class type, cv-qualifiers are ignored.
+/// \tparam U A complete class type of the source instance, u.
+/// \return true if there exists a valid conversion from U const& to T const&.
+template<typename T, typename U>
+typename std::enable_if<!std::is_pointer<U>::value, bool>::type runtime_is(U const& u) noexcept {
+    using impl_type = typename std::remove_cv<T>::type;
+    return detail::runtime_is_impl<impl_type>(u, std::is_base_of<impl_type, U>());
+}
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_IS_HPP
@@ -0,0 +1,227 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_VISIT_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_VISIT_HPP
+
+/// \file runtime_visit.hpp
+/// \brief Contains boost::typeindex::runtime_visit function that dispatches on the
+/// dynamic type of an object among a list of candidate types.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
+#include <boost/type_index/runtime_cast/register_runtime_class.hpp>
+
+#ifdef BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_VTABLE_KEY
+#include <boost/type_index/runtime_cast/detail/runtime_cast_memo.hpp>
+#endif
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+namespace detail {
+
+// Index of the first matching candidate and the offset of the candidate
+// subobject from the source pointer
+struct runtime_visit_match {
+    std::size_t index_;
+    std::ptrdiff_t offset_;
+};
+
+// Index of the first of the Targets that is a base of U or U itself. Such target always
+// matches, so the targets after it are never checked.
+template <class U, class Targets>
+struct runtime_visit_static_index;
+
+template <class U>
+struct runtime_visit_static_index<U, runtime_class_list<> > : std::integral_constant<std::size_t, 0> {};
+
+template <class U, class Target, class... Targets>
+struct runtime_visit_static_index<U, runtime_class_list<Target, Targets...> > : std::integral_constant<std::size_t,
+    std::is_base_of<Target, U>::value ? 0 : 1 + runtime_visit_static_index<U, runtime_class_list<Targets...> >::value
+> {};
+
+// First N of the Targets, they are resolved at runtime
+template <std::size_t N, class Targets, class Result = runtime_class_list<> >
+struct runtime_visit_take {
+    using type = Result;
+};
+
+template <std::size_t N, class Target, class... Targets, class... Result>
+struct runtime_visit_take<N, runtime_class_list<Target, Targets...>, runtime_class_list<Result...> >
+    : std::conditional<
+        N == 0,
+        runtime_visit_take<0, runtime_class_list<>, runtime_class_list<Result...> >,
+        runtime_visit_take<N - 1, runtime_class_list<Targets...>, runtime_class_list<Result..., Target> >
+    >::type
+{};
+
+// Offset of the base subobject Target of U. Computed on each call and never remembered
+// in the tables, because it depends only on the static type of the source.
+template <class Target, class U>
+std::ptrdiff_t runtime_visit_upcast(const U* u) noexcept {
+    return reinterpret_cast<const char*>(static_cast<const Target*>(u)) - reinterpret_cast<const char*>(u);
+}
+
+// Checks all the Targets in a single scan of the ancestors of the dynamic type
+template <class U, class... Targets>
+runtime_visit_match runtime_visit_resolve(const U* u, runtime_class_list<Targets...>) noexcept {
+    const runtime_class_fingerprint* const fingerprints[] = { &detail::runtime_class_fingerprint_of<Targets>()... };
+    std::size_t index;
+    const void* const result = u->boost_type_index_find_first_(fingerprints, sizeof...(Targets), index);
+    return runtime_visit_match{
+        index, result ? static_cast<const char*>(result) - reinterpret_cast<const char*>(u) : 0
+    };
+}
+
+template <class U, class Targets>
+runtime_visit_match runtime_visit_find(const U* u, Targets targets) noexcept {
+#ifdef BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_VTABLE_KEY
+    detail::runtime_cast_memo<detail::runtime_visit_match>& memo
+        = detail::runtime_cast_memo_instance<Targets, detail::runtime_visit_match>();
+    const void* const vtable = detail::runtime_cast_vtable(u);
+
+    detail::runtime_visit_match match;
+    if (!memo.find(vtable, match)) {
+        match = detail::runtime_visit_resolve(u, targets);
+        memo.insert(vtable, match);
+    }
+    return match;
+#else
+    return detail::runtime_visit_resolve(u, targets);
+#endif
+}
+
+template <class U>
+runtime_visit_match runtime_visit_find(const U*, runtime_class_list<>) noexcept {
+    return runtime_visit_match{0, 0};
+}
+
+template <std::size_t... I>
+struct runtime_visit_indexes {};
+
+template <std::size_t N, std::size_t... I>
+struct make_runtime_visit_indexes : make_runtime_visit_indexes<N - 1, N - 1, I...> {};
+
+template <std::size_t... I>
+struct make_runtime_visit_indexes<0, I...> {
+    using type = runtime_visit_indexes<I...>;
+};
+
+template <class U, class Targets, class Result, class Handlers>
+struct runtime_visit_dispatch;
+
+template <class U, class... Targets, class Result, class... Handlers>
+struct runtime_visit_dispatch<U, runtime_class_list<Targets...>, Result, std::tuple<Handlers...> > {
+    using handlers_type = std::tuple<Handlers...>;
+    using thunk_type = Result (*)(char*, handlers_type&);
+
+    template <class T>
+    using qualified = typename std::conditional<std::is_const<U>::value, const T, T>::type;
+
+    template <std::size_t I, class Target>
+    static Result call(char* p, handlers_type& handlers) {
+        return std::forward<typename std::tuple_element<I, handlers_type>::type>(std::get<I>(handlers))(
+            *reinterpret_cast<qualified<Target>*>(p)
+        );
+    }
+
+    template <std::size_t... I>
+    static Result invoke(std::size_t index, char* p, handlers_type& handlers, runtime_visit_indexes<I...>) {
+        // Last handler is called with the source object if none of the targets match
+        static constexpr thunk_type thunks[] = { &call<I, Targets>..., &call<sizeof...(Targets), U> };
+        return thunks[index](p, handlers);
+    }
+};
+
+} // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \brief Calls the handler for the first of the `Targets` that the object `*u` could be
+/// converted to with boost::typeindex::runtime_cast.
+///
+/// Replaces chains of `if (auto* p = runtime_cast<A*>(u)) ... else if (auto* p = runtime_cast<B*>(u)) ...`.
+/// The match is resolved once for each dynamic type of the source object and for each list of `Targets`.
+/// The result is remembered in a process wide table, so that later calls for objects of the same dynamic
+/// type cost a lookup in that table and an indirect call of the handler. The table is used only on platforms
+/// with the Itanium C++ ABI, on other platforms the match is resolved on each call. All the targets are checked
+/// in a single scan of the ancestors of the dynamic type. Targets that are bases of U match without a search,
+/// the targets after the first such one are never checked.
+///
+/// \b Example:
+/// \code
+/// const double area = boost::typeindex::runtime_visit<circle, square>(shape_ptr,
+///     [](circle& c) { return 3.14159 * c.r * c.r; },
+///     [](square& s) { return s.side * s.side; },
+///     [](shape&) { return 0.0; }  // none of the targets match
+/// );
+/// \endcode
+///
+/// \tparam Targets Candidate types in the order of preference. Must be complete class types.
+/// \tparam U A complete polymorphic class type of the source instance, u.
+/// \param u Pointer to the source object, must not be null.
+/// \param handlers `sizeof...(Targets) + 1` callables. The handler number `I` is called with a reference to
+/// `Targets[I]` (const if U is const); the last one is called with `*u` if none of the targets match.
+/// \return Value returned by the called handler, converted to the type that the last handler returns.
+template <class... Targets, class U, class... Handlers>
+auto runtime_visit(U* u, Handlers&&... handlers)
+    -> decltype(std::get<sizeof...(Targets)>(std::forward_as_tuple(std::forward<Handlers>(handlers)...))(*u))
+{
+    static_assert(sizeof...(Handlers) == sizeof...(Targets) + 1,
+        "runtime_visit requires a handler for each target type and a handler for the case when none of them match");
+
+    using result_type = decltype(std::get<sizeof...(Targets)>(std::forward_as_tuple(std::forward<Handlers>(handlers)...))(*u));
+    using targets = detail::runtime_class_list<typename std::remove_cv<Targets>::type...>;
+    using dispatch = detail::runtime_visit_dispatch<U, targets, result_type, std::tuple<Handlers&&...> >;
+
+    // Targets before the first base of U are resolved at runtime, the results are remembered
+    constexpr std::size_t static_index = detail::runtime_visit_static_index<typename std::remove_cv<U>::type, targets>::value;
+    using static_target = typename std::tuple_element<
+        static_index, std::tuple<typename std::remove_cv<Targets>::type..., typename std::remove_cv<U>::type>
+    >::type;
+
+    detail::runtime_visit_match match = detail::runtime_visit_find(
+        u, typename detail::runtime_visit_take<static_index, targets>::type()
+    );
+    if (match.index_ == static_index) {
+        // If none of the Targets is a base of U, static_target is U and the offset is 0
+        match.offset_ = detail::runtime_visit_upcast<static_target>(u);
+    }
+
+    std::tuple<Handlers&&...> handlers_tuple(std::forward<Handlers>(handlers)...);
+    char* const source = const_cast<char*>(reinterpret_cast<const char*>(u));
+    return dispatch::invoke(
+        match.index_, source + match.offset_, handlers_tuple,
+        typename detail::make_runtime_visit_indexes<sizeof...(Targets)>::type()
+    );
+}
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_RUNTIME_VISIT_HPP
@@ -10,7 +10,7 @@
 #define BOOST_TYPE_INDEX_RUNTIME_CAST_STD_SHARED_PTR_CAST_HPP
 
 /// \file std_shared_ptr_cast.hpp
-/// \brief Contains the overload of boost::typeindex::runtime_pointer_cast for
+/// \brief Contains the overloads of boost::typeindex::runtime_pointer_cast for
 /// std::shared_ptr types.
 
 #include <boost/type_index/detail/config.hpp>
@@ -22,6 +22,7 @@
 #if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
 #ifndef BOOST_TYPE_INDEX_USE_IMPORT_STD
 #include <memory>
+#include <utility>
 #endif
 #endif
 
@@ -51,6 +52,32 @@ std::shared_ptr<T> runtime_pointer_cast(std::shared_ptr<U> const& u) {
     return std::shared_ptr<T>();
 }
 
+/// \brief Creates a new instance of std::shared_ptr whose stored pointer is obtained from u's
+/// stored pointer using a runtime_cast, taking the ownership from u.
+///
+/// On success u becomes empty and the new shared_ptr owns what u owned. The reference counter is not
+/// changed if the standard library provides the moving aliasing constructor of std::shared_ptr (C++20),
+/// otherwise it is incremented and decremented once. If the runtime_cast performed by runtime_pointer_cast
+/// returns a null pointer, u is not modified.
+/// \tparam T The desired target type to return a pointer of.
+/// \tparam U A complete class type of the source instance pointed to from u.
+/// \return If there exists a valid conversion from U* to T*, returns a std::shared_ptr<T>
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns std::shared_ptr<T>();
+template<typename T, typename U>
+std::shared_ptr<T> runtime_pointer_cast(std::shared_ptr<U>&& u) {
+    T* value = detail::runtime_cast_impl<T>(u.get(), std::is_base_of<T, U>());
+    if(!value)
+        return std::shared_ptr<T>();
+#if BOOST_CXX_VERSION >= 202002L && (!defined(_LIBCPP_VERSION) || _LIBCPP_VERSION >= 170000)
+    return std::shared_ptr<T>(std::move(u), value);
+#else
+    std::shared_ptr<T> result(u, value);
+    u.reset();
+    return result;
+#endif
+}
+
 BOOST_TYPE_INDEX_END_MODULE_EXPORT
 
 }} // namespace boost::typeindex
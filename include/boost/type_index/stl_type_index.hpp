@@ -67,6 +67,11 @@
 # endif
 #endif
 
+#if defined(BOOST_TYPE_INDEX_BUILTIN_DEMANGLE) && defined(BOOST_TYPE_INDEX_IMPL_HAS_CXXABI)
+#  define BOOST_TYPE_INDEX_DETAIL_BUILTIN_DEMANGLE
+#  include <boost/type_index/detail/itanium_demangle.hpp>
+#endif
+
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
 #endif
@@ -99,6 +104,76 @@ inline void demangle_free(const void* ) noexcept {}
 
 #undef BOOST_TYPE_INDEX_IMPL_HAS_CXXABI
 
+// Demangles the name returned by type_info::name(), strips the cvr_saver wrapper and appends the result to `out`.
+// Returns false if the name can not be demangled.
+inline bool append_pretty_name(const char* name, std::string& out) {
+    static const char cvr_saver_name[] = "boost::typeindex::detail::cvr_saver";
+    constexpr std::string::size_type cvr_saver_name_len = sizeof(cvr_saver_name) - 1;
+
+#ifdef BOOST_TYPE_INDEX_DETAIL_BUILTIN_DEMANGLE
+    {
+        char buffer[detail::itanium_demangle_buffer_size];
+        const std::size_t length = detail::itanium_type_demangler(name, buffer, sizeof(buffer)).demangle();
+        if (length) {
+            out.append(buffer, length);
+            return true;
+        }
+    }
+#endif
+
+    // In case of MSVC demangle() is a no-op, and name() already returns demangled name.
+    // In case of GCC and Clang (on non-Windows systems) name() returns mangled name and demangle() undecorates it.
+    const std::unique_ptr<const char, void(*)(const void*)> demangled_name(
+        demangle_alloc(name), &demangle_free
+    );
+
+    const char* begin = demangled_name.get();
+    if (!begin) {
+        return false;
+    }
+
+    const std::string::size_type len = std::strlen(begin);
+    const char* end = begin + len;
+
+    if (len > cvr_saver_name_len) {
+        const char* b = std::strstr(begin, cvr_saver_name);
+        if (b) {
+            b += cvr_saver_name_len;
+
+            // Trim everything till '<'. In modules the name could be boost::typeindex::detail::cvr_saver@boost.type_index<
+            while (*b != '<') {         // the string is zero terminated, we won't exceed the buffer size
+                ++ b;
+            }
+            ++b;
+
+            // Trim leading spaces
+            while (*b == ' ') {         // the string is zero terminated, we won't exceed the buffer size
+                ++ b;
+            }
+
+            // Skip the closing angle bracket
+            const char* e = end - 1;
+            while (e > b && *e != '>') {
+                -- e;
+            }
+
+            // Trim trailing spaces
+            while (e > b && *(e - 1) == ' ') {
+                -- e;
+            }
+
+            if (b < e) {
+                // Parsing seems to have succeeded, the type name is not empty
+                begin = b;
+                end = e;
+            }
+        }
+    }
+
+    out.append(begin, end);
+    return true;
+}
+
 }  // namespace impl
 
 BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
@@ -177,59 +252,11 @@ inline const char* stl_type_index::name() const noexcept {
 }
 
 inline std::string stl_type_index::pretty_name() const {
-    static const char cvr_saver_name[] = "boost::typeindex::detail::cvr_saver";
-    constexpr std::string::size_type cvr_saver_name_len = sizeof(cvr_saver_name) - 1;
-
-    // In case of MSVC demangle() is a no-op, and name() already returns demangled name.
-    // In case of GCC and Clang (on non-Windows systems) name() returns mangled name and demangle() undecorates it.
-    const std::unique_ptr<const char, void(*)(const void*)> demangled_name(
-        impl::demangle_alloc(data_->name()), &impl::demangle_free
-    );
-
-    const char* begin = demangled_name.get();
-    if (!begin) {
+    std::string result;
+    if (!impl::append_pretty_name(data_->name(), result)) {
         boost::throw_exception(std::runtime_error("Type name demangling failed"));
     }
-
-    const std::string::size_type len = std::strlen(begin);
-    const char* end = begin + len;
-
-    if (len > cvr_saver_name_len) {
-        const char* b = std::strstr(begin, cvr_saver_name);
-        if (b) {
-            b += cvr_saver_name_len;
-
-            // Trim everything till '<'. In modules the name could be boost::typeindex::detail::cvr_saver@boost.type_index<
-            while (*b != '<') {         // the string is zero terminated, we won't exceed the buffer size
-                ++ b;
-            }
-            ++b;
-
-            // Trim leading spaces
-            while (*b == ' ') {         // the string is zero terminated, we won't exceed the buffer size
-                ++ b;
-            }
-
-            // Skip the closing angle bracket
-            const char* e = end - 1;
-            while (e > b && *e != '>') {
-                -- e;
-            }
-
-            // Trim trailing spaces
-            while (e > b && *(e - 1) == ' ') {
-                -- e;
-            }
-
-            if (b < e) {
-                // Parsing seems to have succeeded, the type name is not empty
-                begin = b;
-                end = e;
-            }
-        }
-    }
-
-    return std::string(begin, end);
+    return result;
 }
 
 
@@ -0,0 +1,500 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_TYPE_MAP_HPP
+#define BOOST_TYPE_INDEX_TYPE_MAP_HPP
+
+/// \file type_map.hpp
+/// \brief Contains boost::typeindex::type_map class - a flat hash map with
+/// boost::typeindex::type_index keys.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/detail/hash_mix.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOOST_TYPE_INDEX_DETAIL_TYPE_MAP_SSE2
+#endif
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+
+#ifdef BOOST_TYPE_INDEX_DETAIL_TYPE_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <boost/throw_exception.hpp>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+namespace detail {
+
+// Control bytes of a type_map. Full slots hold the 7 low bits of the
+// hash, so all the special values have the high bit set.
+struct type_map_ctrl {
+    static constexpr unsigned char empty = 0x80;
+    static constexpr unsigned char deleted = 0xFE;
+    static constexpr std::size_t group_size = 16;
+
+    static unsigned char fragment(std::size_t hash) noexcept {
+        return static_cast<unsigned char>(hash & 0x7F);
+    }
+
+    // Returns a bit mask of the group slots with control byte equal to `value`
+    static unsigned match(const unsigned char* group, unsigned char value) noexcept {
+#ifdef BOOST_TYPE_INDEX_DETAIL_TYPE_MAP_SSE2
+        const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(value)))
+        ));
+#else
+        unsigned mask = 0;
+        for (std::size_t i = 0; i < group_size; ++i) {
+            mask |= static_cast<unsigned>(group[i] == value) << i;
+        }
+        return mask;
+#endif
+    }
+
+    // Returns a bit mask of the group slots that are empty or deleted
+    static unsigned match_free(const unsigned char* group) noexcept {
+#ifdef BOOST_TYPE_INDEX_DETAIL_TYPE_MAP_SSE2
+        return static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(group))
+        ));
+#else
+        unsigned mask = 0;
+        for (std::size_t i = 0; i < group_size; ++i) {
+            mask |= static_cast<unsigned>(group[i] >> 7) << i;
+        }
+        return mask;
+#endif
+    }
+
+    static std::size_t lowest_bit(unsigned mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctz(mask));
+#else
+        std::size_t i = 0;
+        while (!(mask & 1u)) {
+            mask >>= 1;
+            ++i;
+        }
+        return i;
+#endif
+    }
+};
+
+} // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// \class type_map
+/// Flat open addressing hash map with boost::typeindex::type_index keys.
+///
+/// Unlike `boost::unordered_set<type_index>` and other containers that use
+/// boost::typeindex::hash_value() the hash of each key is computed only once on insertion and is stored
+/// in the container. Slots are probed in groups of 16 using SIMD instructions where available. Keys are
+/// compared by the address of their type_info first and only the keys with equal hashes are compared by names.
+///
+/// References and iterators are invalidated on rehashing.
+///
+/// \b Example:
+/// \code
+/// boost::typeindex::type_map<std::string> descriptions;
+/// descriptions[boost::typeindex::type_id<int>()] = "integer";
+/// assert(descriptions.find(boost::typeindex::type_id_runtime(variable)) != descriptions.end());
+/// \endcode
+///
+/// \tparam V Type of the mapped values.
+template <class V>
+class type_map {
+public:
+    using key_type = type_index;
+    using mapped_type = V;
+    using value_type = std::pair<const type_index, V>;
+    using size_type = std::size_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    using ctrl = detail::type_map_ctrl;
+
+    struct slot_type {
+        std::size_t hash_;  // mixed hash_code() of the key
+        alignas(value_type) unsigned char storage_[sizeof(value_type)];
+
+        value_type& value() noexcept {
+            return *reinterpret_cast<value_type*>(storage_);
+        }
+    };
+
+    template <class Value>
+    class iterator_impl {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        iterator_impl() noexcept = default;
+
+        template <class Other, class = typename std::enable_if<std::is_convertible<Other*, Value*>::value>::type>
+        iterator_impl(const iterator_impl<Other>& other) noexcept
+            : map_(other.map_)
+            , index_(other.index_)
+        {}
+
+        reference operator*() const noexcept { return map_->slots_[index_].value(); }
+        pointer operator->() const noexcept { return std::addressof(**this); }
+
+        iterator_impl& operator++() noexcept {
+            index_ = map_->next_full(index_ + 1);
+            return *this;
+        }
+
+        iterator_impl operator++(int) noexcept {
+            iterator_impl tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+    private:
+        friend class type_map;
+        template <class> friend class iterator_impl;
+
+        iterator_impl(const type_map* map, std::size_t index) noexcept
+            : map_(map)
+            , index_(index)
+        {}
+
+        const type_map* map_ = nullptr;
+        std::size_t index_ = 0;
+    };
+
+public:
+    using iterator = iterator_impl<value_type>;
+    using const_iterator = iterator_impl<const value_type>;
+
+    type_map() noexcept = default;
+
+    type_map(const type_map& other)
+        : type_map()
+    {
+        reserve(other.size());
+        for (std::size_t i = other.next_full(0); i < other.capacity_; i = other.next_full(i + 1)) {
+            const value_type& v = other.slots_[i].value();
+            insert_unique(v.first, other.slots_[i].hash_, v.second);
+        }
+    }
+
+    type_map(type_map&& other) noexcept
+        : type_map()
+    {
+        swap(other);
+    }
+
+    type_map& operator=(const type_map& other) {
+        type_map(other).swap(*this);
+        return *this;
+    }
+
+    type_map& operator=(type_map&& other) noexcept {
+        type_map(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~type_map() {
+        destroy_all();
+    }
+
+    iterator begin() noexcept { return iterator(this, next_full(0)); }
+    iterator end() noexcept { return iterator(this, capacity_); }
+    const_iterator begin() const noexcept { return const_iterator(this, next_full(0)); }
+    const_iterator end() const noexcept { return const_iterator(this, capacity_); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    bool empty() const noexcept { return !size_; }
+    size_type size() const noexcept { return size_; }
+
+    /// \return Count of slots. Container is rehashed when it is 7/8 full.
+    size_type capacity() const noexcept { return capacity_; }
+
+    void clear() noexcept {
+        destroy_all();
+        if (capacity_) {
+            std::memset(ctrl_.get(), ctrl::empty, capacity_);
+        }
+        size_ = 0;
+        deleted_ = 0;
+    }
+
+    /// Makes sure that `count` elements could be stored without rehashing.
+    void reserve(size_type count) {
+        if (!count) {
+            return;
+        }
+
+        std::size_t capacity = ctrl::group_size;
+        while (capacity - capacity / 8 < count) {
+            capacity *= 2;
+        }
+        if (capacity > capacity_) {
+            rehash(capacity);
+        }
+    }
+
+    template <class... Args>
+    std::pair<iterator, bool> emplace(const key_type& key, Args&&... args) {
+        return insert_impl(key, hash_of(key), std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return emplace(value.first, std::move(value.second));
+    }
+
+    template <class M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value) {
+        const std::size_t hash = hash_of(key);
+        const std::size_t i = find_index(key, hash);
+        if (i != capacity_) {
+            slots_[i].value().second = std::forward<M>(value);
+            return std::pair<iterator, bool>(iterator(this, i), false);
+        }
+        return std::pair<iterator, bool>(insert_unique(key, hash, std::forward<M>(value)), true);
+    }
+
+    mapped_type& operator[](const key_type& key) {
+        return emplace(key).first->second;
+    }
+
+    mapped_type& at(const key_type& key) {
+        const std::size_t i = find_index(key, hash_of(key));
+        if (i == capacity_) {
+            boost::throw_exception(std::out_of_range("boost::typeindex::type_map::at: key not found"));
+        }
+        return slots_[i].value().second;
+    }
+
+    const mapped_type& at(const key_type& key) const {
+        return const_cast<type_map&>(*this).at(key);
+    }
+
+    iterator find(const key_type& key) noexcept {
+        return iterator(this, find_index(key, hash_of(key)));
+    }
+
+    const_iterator find(const key_type& key) const noexcept {
+        return const_iterator(this, find_index(key, hash_of(key)));
+    }
+
+    size_type count(const key_type& key) const noexcept {
+        return find_index(key, hash_of(key)) != capacity_;
+    }
+
+    bool contains(const key_type& key) const noexcept {
+        return find_index(key, hash_of(key)) != capacity_;
+    }
+
+    iterator erase(const_iterator it) noexcept {
+        erase_index(it.index_);
+        return iterator(this, next_full(it.index_ + 1));
+    }
+
+    size_type erase(const key_type& key) noexcept {
+        const std::size_t i = find_index(key, hash_of(key));
+        if (i == capacity_) {
+            return 0;
+        }
+        erase_index(i);
+        return 1;
+    }
+
+    void swap(type_map& other) noexcept {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(deleted_, other.deleted_);
+    }
+
+    friend void swap(type_map& lhs, type_map& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+private:
+    // Control fragments and groups are taken from different bits of the hash, so hash_code() is mixed first
+    static std::size_t hash_of(const key_type& key) noexcept {
+        return detail::hash_mix(key.hash_code());
+    }
+
+    static bool keys_equal(const key_type& lhs, const key_type& rhs) noexcept {
+        return std::addressof(lhs.type_info()) == std::addressof(rhs.type_info()) || lhs == rhs;
+    }
+
+    std::size_t next_full(std::size_t i) const noexcept {
+        while (i < capacity_ && (ctrl_[i] & 0x80)) {
+            ++i;
+        }
+        return i;
+    }
+
+    // Triangular probing over groups visits every group if count of groups is a power of 2
+    std::size_t first_group(std::size_t hash) const noexcept {
+        return (hash >> 7) & (capacity_ / ctrl::group_size - 1);
+    }
+
+    std::size_t next_group(std::size_t group, std::size_t step) const noexcept {
+        return (group + step) & (capacity_ / ctrl::group_size - 1);
+    }
+
+    std::size_t find_index(const key_type& key, std::size_t hash) const noexcept {
+        if (!size_) {
+            return capacity_;
+        }
+
+        const unsigned char fragment = ctrl::fragment(hash);
+        std::size_t group = first_group(hash);
+        for (std::size_t step = 1; step <= capacity_ / ctrl::group_size; ++step) {
+            const std::size_t first = group * ctrl::group_size;
+            const unsigned char* ctrl_group = ctrl_.get() + first;
+            for (unsigned m = ctrl::match(ctrl_group, fragment); m; m &= m - 1) {
+                const std::size_t i = first + ctrl::lowest_bit(m);
+                if (slots_[i].hash_ == hash && keys_equal(slots_[i].value().first, key)) {
+                    return i;
+                }
+            }
+
+            if (ctrl::match(ctrl_group, ctrl::empty)) {
+                break;
+            }
+            group = next_group(group, step);
+        }
+
+        return capacity_;
+    }
+
+    // Container always has free slots, because it is rehashed when it is 7/8 full
+    std::size_t find_free(std::size_t hash) const noexcept {
+        std::size_t group = first_group(hash);
+        for (std::size_t step = 1;; ++step) {
+            const std::size_t first = group * ctrl::group_size;
+            const unsigned m = ctrl::match_free(ctrl_.get() + first);
+            if (m) {
+                return first + ctrl::lowest_bit(m);
+            }
+            group = next_group(group, step);
+        }
+    }
+
+    template <class... Args>
+    std::pair<iterator, bool> insert_impl(const key_type& key, std::size_t hash, Args&&... args) {
+        const std::size_t i = find_index(key, hash);
+        if (i != capacity_) {
+            return std::pair<iterator, bool>(iterator(this, i), false);
+        }
+        return std::pair<iterator, bool>(insert_unique(key, hash, std::forward<Args>(args)...), true);
+    }
+
+    // `key` is taken by copy, because it may reference an element that is moved during rehashing
+    template <class... Args>
+    iterator insert_unique(const key_type key, std::size_t hash, Args&&... args) {
+        if (size_ + deleted_ + 1 > capacity_ - capacity_ / 8) {
+            // Reusing the same capacity if most of the occupied slots are deleted ones
+            rehash(capacity_ && size_ < capacity_ / 2 ? capacity_ : (capacity_ ? capacity_ * 2 : ctrl::group_size));
+        }
+
+        const std::size_t i = find_free(hash);
+        ::new (static_cast<void*>(slots_[i].storage_)) value_type(
+            std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...)
+        );
+        slots_[i].hash_ = hash;
+        if (ctrl_[i] == ctrl::deleted) {
+            --deleted_;
+        }
+        ctrl_[i] = ctrl::fragment(hash);
+        ++size_;
+        return iterator(this, i);
+    }
+
+    void erase_index(std::size_t i) noexcept {
+        slots_[i].value().~value_type();
+        ctrl_[i] = ctrl::deleted;
+        --size_;
+        ++deleted_;
+    }
+
+    void destroy_all() noexcept {
+        for (std::size_t i = next_full(0); i < capacity_; i = next_full(i + 1)) {
+            slots_[i].value().~value_type();
+        }
+    }
+
+    void rehash(std::size_t capacity) {
+        type_map tmp;
+        tmp.ctrl_.reset(new unsigned char[capacity]);
+        tmp.slots_.reset(new slot_type[capacity]);
+        tmp.capacity_ = capacity;
+        std::memset(tmp.ctrl_.get(), ctrl::empty, capacity);
+
+        for (std::size_t i = next_full(0); i < capacity_; i = next_full(i + 1)) {
+            value_type& v = slots_[i].value();
+            tmp.insert_unique(v.first, slots_[i].hash_, std::move_if_noexcept(v.second));
+        }
+
+        swap(tmp);
+    }
+
+    std::unique_ptr<unsigned char[]> ctrl_;
+    std::unique_ptr<slot_type[]> slots_;
+    std::size_t capacity_ = 0;
+    std::size_t size_ = 0;
+    std::size_t deleted_ = 0;
+};
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_TYPE_MAP_HPP
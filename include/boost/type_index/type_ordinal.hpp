@@ -0,0 +1,122 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_TYPE_ORDINAL_HPP
+#define BOOST_TYPE_INDEX_TYPE_ORDINAL_HPP
+
+/// \file type_ordinal.hpp
+/// \brief Contains boost::typeindex::type_ordinal functions that assign small dense
+/// integers to types.
+///
+/// Ordinals could be used as indexes into plain arrays instead of using
+/// boost::typeindex::type_index as a key in hash maps.
+
+#include <boost/type_index/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/concurrent_type_map.hpp>
+
+#if !defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+#ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <cstddef>
+#include <mutex>
+#endif
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+namespace detail {
+
+// Serializes the assignment of ordinals, so that each ordinal is equal to
+// the count of types that got their ordinals before.
+class type_ordinal_table {
+public:
+    std::size_t size() const noexcept {
+        return ordinals_.size();
+    }
+
+    std::size_t ordinal(const type_index& key) {
+        if (const std::size_t* ordinal = ordinals_.find(key)) {
+            return *ordinal;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ordinals_.emplace(key, ordinals_.size()).first;
+    }
+
+private:
+    concurrent_type_map<std::size_t> ordinals_;
+    std::mutex mutex_;
+};
+
+// Must have a single instance in the whole process, even if modules are
+// built with hidden visibility. The table is never destroyed, so that
+// ordinals remain usable in destructors of static objects.
+BOOST_SYMBOL_VISIBLE inline type_ordinal_table& type_ordinal_table_instance() {
+    static type_ordinal_table* const instance = new type_ordinal_table();
+    return *instance;
+}
+
+} // namespace detail
+
+BOOST_TYPE_INDEX_BEGIN_MODULE_EXPORT
+
+/// Returns a small dense integer for a type. First type that is passed to this function
+/// gets 0, the second distinct type gets 1 and so forth. Equal type_index instances always
+/// get the same ordinal, that does not change till the end of the program.
+///
+/// Function is thread safe. After the ordinal of a type was assigned, the function does
+/// not lock and costs a hash_code() call and a lookup in a hash table.
+///
+/// \b Example:
+/// \code
+/// std::vector<std::size_t> counters;
+/// ...
+/// const std::size_t i = boost::typeindex::type_ordinal(boost::typeindex::type_id_runtime(*ptr));
+/// if (i >= counters.size()) counters.resize(i + 1);
+/// ++counters[i];
+/// \endcode
+///
+/// \note Modules that had type_index instances passed to this function must not be unloaded.
+/// \throw std::bad_alloc if ordinal was not assigned and there is not enough memory to assign it.
+/// \param type Type to get the ordinal for.
+/// \return Ordinal of the type.
+inline std::size_t type_ordinal(const type_index& type) {
+    return detail::type_ordinal_table_instance().ordinal(type);
+}
+
+/// Returns the same value as `type_ordinal(boost::typeindex::type_id<T>())`. After the first call
+/// the ordinal is cached and the function costs only a check of a function local static variable.
+///
+/// \tparam T Type to get the ordinal for. Const, volatile and reference modifiers are removed.
+/// \throw std::bad_alloc if ordinal was not assigned and there is not enough memory to assign it.
+/// \return Ordinal of the type T.
+template <class T>
+inline std::size_t type_ordinal() {
+    static const std::size_t ordinal = boost::typeindex::type_ordinal(boost::typeindex::type_id<T>());
+    return ordinal;
+}
+
+/// \return Count of ordinals that were assigned so far. All the ordinals are less than that value.
+inline std::size_t type_ordinals_count() {
+    return detail::type_ordinal_table_instance().size();
+}
+
+BOOST_TYPE_INDEX_END_MODULE_EXPORT
+
+}} // namespace boost::typeindex
+
+#endif  // #if !defined(BOOST_USE_MODULES) || defined(BOOST_TYPE_INDEX_INTERFACE_UNIT)
+
+#endif // BOOST_TYPE_INDEX_TYPE_ORDINAL_HPP
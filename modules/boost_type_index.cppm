@@ -21,15 +21,37 @@ module;
 #include <boost/container_hash/hash.hpp>
 #include <boost/throw_exception.hpp>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#endif
+
 #ifndef BOOST_TYPE_INDEX_USE_STD_MODULE
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <cstdlib>
+#include <exception>
+#include <functional>
+#include <initializer_list>
 #include <iosfwd>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <typeinfo>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef BOOST_TYPE_INDEX_CTTI_INTERN_NAMES
+#include <unordered_set>
+#endif
 #endif
 
 #ifdef BOOST_TYPE_INDEX_USER_TYPEINDEX
@@ -51,15 +73,26 @@ import std;
 #endif
 
 #include <boost/type_index.hpp>
+#include <boost/type_index/concurrent_type_map.hpp>
 #include <boost/type_index/ctti_type_index.hpp>
+#include <boost/type_index/frozen_type_map.hpp>
+#include <boost/type_index/pretty_name_cstr.hpp>
 #include <boost/type_index/runtime_cast.hpp>
 #include <boost/type_index/runtime_cast/boost_shared_ptr_cast.hpp>
 #include <boost/type_index/runtime_cast/pointer_cast.hpp>
 #include <boost/type_index/runtime_cast/reference_cast.hpp>
 #include <boost/type_index/runtime_cast/register_runtime_class.hpp>
+#include <boost/type_index/runtime_cast/runtime_cast_cache.hpp>
+#include <boost/type_index/runtime_cast/runtime_cast_filter.hpp>
+#include <boost/type_index/runtime_cast/runtime_cast_stats.hpp>
+#include <boost/type_index/runtime_cast/runtime_is.hpp>
+#include <boost/type_index/runtime_cast/runtime_visit.hpp>
 #include <boost/type_index/runtime_cast/std_shared_ptr_cast.hpp>
 #ifndef BOOST_NO_RTTI
+#include <boost/type_index/pretty_name_batch.hpp>
 #include <boost/type_index/stl_type_index.hpp>
 #endif
 #include <boost/type_index/type_index_facade.hpp>
+#include <boost/type_index/type_map.hpp>
+#include <boost/type_index/type_ordinal.hpp>
 
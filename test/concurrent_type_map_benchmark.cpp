@@ -0,0 +1,199 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures scaling of concurrent lookups in boost::typeindex::concurrent_type_map and in
+// boost::unordered_map<type_index, V> protected by a std::mutex for 1 to 64 threads, with and without
+// a thread that inserts new types during the lookups. Prints the results as JSON to stdout.
+//
+// Usage: concurrent_type_map_benchmark [max_threads [lookups_per_thread]]
+
+#include <boost/type_index/concurrent_type_map.hpp>
+#include <boost/config.hpp>
+#include <boost/unordered_map.hpp>
+
+#include "type_map_benchmark_types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using boost::typeindex::type_index;
+
+// Types that are in the map before the lookups start, the rest are inserted by the writer
+constexpr std::size_t initial_types = 512;
+
+struct result {
+    std::string container;
+    std::size_t threads;
+    bool writer;
+    double lookup_ns;
+    double total_mops;
+};
+
+std::vector<result> results;
+std::size_t lookups = 1000000;
+
+class concurrent_map {
+public:
+    static const char* name() noexcept { return "boost::typeindex::concurrent_type_map"; }
+
+    bool contains(const type_index& key) const noexcept { return map_.contains(key); }
+    void insert(const type_index& key, int value) { map_.emplace(key, value); }
+
+private:
+    boost::typeindex::concurrent_type_map<int> map_;
+};
+
+class locked_map {
+public:
+    static const char* name() noexcept { return "boost::unordered_map with std::mutex"; }
+
+    bool contains(const type_index& key) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return map_.find(key) != map_.end();
+    }
+
+    void insert(const type_index& key, int value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        map_.emplace(key, value);
+    }
+
+private:
+    mutable std::mutex mutex_;
+    boost::unordered_map<type_index, int> map_;
+};
+
+template <class Map>
+void bench(const std::vector<type_index>& types, std::size_t threads, bool writer) {
+    Map map;
+    for (std::size_t i = 0; i < initial_types; ++i) {
+        map.insert(types[i], static_cast<int>(i));
+    }
+
+    std::atomic<std::size_t> ready{0};
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> found{0};
+
+    std::vector<std::thread> readers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        readers.emplace_back([&, t]() {
+            benchmark_random random(t);
+            std::vector<type_index> queries;
+            for (std::size_t i = 0; i < 4096; ++i) {
+                queries.push_back(types[random(initial_types)]);
+            }
+
+            ++ready;
+            while (!start) {
+                std::this_thread::yield();
+            }
+
+            std::size_t local = 0;
+            for (std::size_t i = 0; i < lookups; ++i) {
+                local += map.contains(queries[i % queries.size()]);
+            }
+            found += local;
+        });
+    }
+
+    std::thread inserter;
+    if (writer) {
+        inserter = std::thread([&]() {
+            for (std::size_t i = initial_types; i < types.size() && !stop; ++i) {
+                map.insert(types[i], static_cast<int>(i));
+                std::this_thread::sleep_for(std::chrono::microseconds(10));
+            }
+        });
+    }
+
+    while (ready != threads) {
+        std::this_thread::yield();
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    start = true;
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    const auto finish = std::chrono::steady_clock::now();
+
+    stop = true;
+    if (inserter.joinable()) {
+        inserter.join();
+    }
+
+    if (found != threads * lookups) {
+        std::cerr << "Unexpected lookup results for " << Map::name() << '\n';
+        std::exit(1);
+    }
+
+    // Wall time of a single lookup as seen by each thread, and the total throughput
+    const double ns = std::chrono::duration<double, std::nano>(finish - begin).count();
+    results.push_back(result{Map::name(), threads, writer, ns / lookups, threads * lookups * 1000.0 / ns});
+}
+
+const char* mode() {
+#if defined(BOOST_NO_RTTI)
+    return "no_rtti";
+#elif defined(BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY)
+    return "rtti_ctti";
+#else
+    return "rtti";
+#endif
+}
+
+void print_json() {
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n"
+              << "  \"initial_types\": " << initial_types << ",\n"
+              << "  \"lookups_per_thread\": " << lookups << ",\n"
+              << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        std::cout << "    {\"container\": \"" << r.container
+                  << "\", \"threads\": " << r.threads
+                  << ", \"writer\": " << (r.writer ? "true" : "false")
+                  << ", \"lookup_ns\": " << r.lookup_ns
+                  << ", \"total_mops\": " << r.total_mops
+                  << (i + 1 == results.size() ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t max_threads = 64;
+    if (argc > 1) {
+        max_threads = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+    if (argc > 2) {
+        lookups = static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10));
+    }
+    if (!max_threads || !lookups) {
+        std::cerr << "Usage: " << argv[0] << " [max_threads [lookups_per_thread]]\n";
+        return 1;
+    }
+
+    const std::vector<type_index> types = make_benchmark_types<boost_type_keys, 32>();
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        for (bool writer : {false, true}) {
+            bench<concurrent_map>(types, threads, writer);
+            bench<locked_map>(types, threads, writer);
+        }
+    }
+
+    print_json();
+    return 0;
+}
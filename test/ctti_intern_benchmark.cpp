@@ -0,0 +1,109 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures comparison of ctti_type_index of 1024 types that were constructed in a plugin with
+// the same types constructed in the program and prints the results as JSON to stdout.
+//
+// Usage: ctti_intern_benchmark [iterations]
+//
+// The program and the plugin must be built with hidden visibility, so that each of them has its own
+// copy of the type names. Build them once with BOOST_TYPE_INDEX_CTTI_INTERN_NAMES and once without it
+// to see the difference.
+
+#include "ctti_intern_benchmark.hpp"
+
+#include <boost/version.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+std::size_t iterations = 1000;
+std::size_t sink = 0;
+
+// Best time of several runs, in nanoseconds per comparison
+template <class F>
+double measure(std::size_t comparisons, F f) {
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            sink += f();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / (iterations * comparisons);
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+const char* mode() {
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_INTERNING)
+    return "interned";
+#else
+    return "not_interned";
+#endif
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        iterations = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+        if (!iterations) {
+            std::cerr << "Usage: " << argv[0] << " [iterations]\n";
+            return 1;
+        }
+    }
+
+    const std::vector<boost::typeindex::ctti_type_index> local = make_plugin_types();
+    const std::vector<boost::typeindex::ctti_type_index> plugin = plugin_types();
+    const std::size_t count = local.size();
+
+    std::size_t same_pointers = 0;
+    int errors = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        same_pointers += (local[i].raw_name() == plugin[i].raw_name());
+        if (local[i] != plugin[i] || local[i] == plugin[(i + 1) % count]) {
+            std::cerr << "Unexpected comparison result for " << local[i] << '\n';
+            ++errors;
+        }
+    }
+
+    const double equal_ns = measure(count, [&]() {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            result += (local[i] == plugin[i]);
+        }
+        return result;
+    });
+
+    // Names of neighbours mostly have the same length and differ only near the end
+    const double not_equal_ns = measure(count, [&]() {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            result += (local[i] == plugin[i ^ 1]);
+        }
+        return result;
+    });
+
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"types\": " << count << ",\n"
+              << "  \"same_name_pointers\": " << same_pointers << ",\n"
+              << "  \"iterations\": " << iterations << ",\n"
+              << "  \"equal_types_ns\": " << equal_ns << ",\n"
+              << "  \"different_types_ns\": " << not_equal_ns << "\n"
+              << "}\n";
+
+    return errors;
+}
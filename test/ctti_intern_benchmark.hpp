@@ -0,0 +1,70 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_TYPE_INDEX_TESTS_CTTI_INTERN_BENCHMARK_HPP
+#define BOOST_TYPE_INDEX_TESTS_CTTI_INTERN_BENCHMARK_HPP
+
+#include <boost/type_index/ctti_type_index.hpp>
+#include <boost/config.hpp>
+
+#include <vector>
+
+// This is ALWAYS a dynamic library
+#if defined(CTTI_INTERN_BENCHMARK_PLUGIN_SOURCE)
+#   define CTTI_INTERN_BENCHMARK_PLUGIN_DECL BOOST_SYMBOL_EXPORT
+#else
+#   define CTTI_INTERN_BENCHMARK_PLUGIN_DECL BOOST_SYMBOL_IMPORT
+#endif
+
+namespace plugin_namespace { namespace messages {
+
+template <int Group, int Id>
+struct message {};
+
+}} // namespace plugin_namespace::messages
+
+constexpr int plugin_type_groups = 32;
+constexpr int plugin_types_per_group = 32;
+
+// Appends ctti_type_index of message<Group, 0> ... message<Group, Id>
+template <int Group, int Id>
+struct plugin_type_row {
+    static void append(std::vector<boost::typeindex::ctti_type_index>& types) {
+        plugin_type_row<Group, Id - 1>::append(types);
+        types.push_back(boost::typeindex::ctti_type_index::type_id<plugin_namespace::messages::message<Group, Id> >());
+    }
+};
+
+template <int Group>
+struct plugin_type_row<Group, -1> {
+    static void append(std::vector<boost::typeindex::ctti_type_index>&) {}
+};
+
+// Appends all the types of the groups 0 ... Group
+template <int Group>
+struct plugin_type_rows {
+    static void append(std::vector<boost::typeindex::ctti_type_index>& types) {
+        plugin_type_rows<Group - 1>::append(types);
+        plugin_type_row<Group, plugin_types_per_group - 1>::append(types);
+    }
+};
+
+template <>
+struct plugin_type_rows<-1> {
+    static void append(std::vector<boost::typeindex::ctti_type_index>&) {}
+};
+
+inline std::vector<boost::typeindex::ctti_type_index> make_plugin_types() {
+    std::vector<boost::typeindex::ctti_type_index> types;
+    plugin_type_rows<plugin_type_groups - 1>::append(types);
+    return types;
+}
+
+// Same types as make_plugin_types(), but constructed in the plugin with the plugin's copies of the names
+CTTI_INTERN_BENCHMARK_PLUGIN_DECL std::vector<boost::typeindex::ctti_type_index> plugin_types();
+
+#endif // BOOST_TYPE_INDEX_TESTS_CTTI_INTERN_BENCHMARK_HPP
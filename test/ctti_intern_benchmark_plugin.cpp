@@ -0,0 +1,13 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define CTTI_INTERN_BENCHMARK_PLUGIN_SOURCE
+#include "ctti_intern_benchmark.hpp"
+
+std::vector<boost::typeindex::ctti_type_index> plugin_types() {
+    return make_plugin_types();
+}
@@ -0,0 +1,126 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the builtin demangler of type names that is used if BOOST_TYPE_INDEX_BUILTIN_DEMANGLE
+// is defined and abi::__cxa_demangle on the names produced by typeid() and prints the results
+// as JSON to stdout.
+//
+// Usage: demangle_benchmark [iterations]
+
+#include <boost/type_index/detail/itanium_demangle.hpp>
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <cxxabi.h>
+
+namespace my_namespace {
+    struct my_class {};
+
+    template <class T, int N>
+    struct my_template {};
+}
+
+struct sample {
+    const char* type;
+    const char* mangled;
+};
+
+template <class T>
+sample make_sample(const char* type) {
+    return sample{type, typeid(T).name()};
+}
+
+std::size_t iterations = 100000;
+std::size_t sink = 0;
+int errors = 0;
+
+template <class F>
+double measure(F f) {
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            sink += f();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / iterations;
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+std::size_t builtin_demangle(const char* mangled) {
+    char buffer[boost::typeindex::detail::itanium_demangle_buffer_size];
+    return boost::typeindex::detail::itanium_type_demangler(mangled, buffer, sizeof(buffer)).demangle();
+}
+
+std::size_t cxa_demangle(const char* mangled) {
+    int status = 0;
+    char* const demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    const std::size_t result = (demangled ? demangled[0] : 0);
+    std::free(demangled);
+    return result;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        iterations = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+        if (!iterations) {
+            std::cerr << "Usage: " << argv[0] << " [iterations]\n";
+            return 1;
+        }
+    }
+
+    const sample samples[] = {
+        make_sample<int>("builtin"),
+        make_sample<my_namespace::my_class>("class"),
+        make_sample<const my_namespace::my_class* const*>("pointers"),
+        make_sample<my_namespace::my_template<my_namespace::my_class, 42> >("template"),
+        make_sample<std::string>("std_string"),
+        make_sample<std::vector<std::vector<int> > >("nested_vector"),
+        make_sample<std::map<std::string, std::vector<std::string> > >("map_of_vectors"),
+        make_sample<std::tuple<int, char, std::shared_ptr<std::pair<const std::string, double> > > >("tuple"),
+    };
+
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"iterations\": " << iterations << ",\n"
+              << "  \"results\": [\n";
+    const std::size_t count = sizeof(samples) / sizeof(samples[0]);
+    for (std::size_t i = 0; i < count; ++i) {
+        const char* const mangled = samples[i].mangled;
+        if (!builtin_demangle(mangled)) {
+            std::cerr << "Builtin demangler does not support " << mangled << '\n';
+            ++errors;
+        }
+
+        std::cout << "    {\"type\": \"" << samples[i].type
+                  << "\", \"mangled\": \"" << mangled
+                  << "\", \"builtin_ns\": " << measure([mangled]() { return builtin_demangle(mangled); })
+                  << ", \"cxa_demangle_ns\": " << measure([mangled]() { return cxa_demangle(mangled); })
+                  << (i + 1 == count ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+
+    return errors;
+}
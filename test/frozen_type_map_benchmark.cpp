@@ -0,0 +1,200 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures construction time and lookups of boost::typeindex::frozen_type_map and compares them with
+// boost::typeindex::type_map and the Boost.Unordered containers from examples/registry.cpp for 10 to 10k types.
+// Prints the results as JSON to stdout.
+//
+// Usage: frozen_type_map_benchmark [lookups]
+
+#include <boost/type_index/frozen_type_map.hpp>
+#include <boost/type_index/type_map.hpp>
+#include <boost/config.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/unordered_set.hpp>
+#include <boost/version.hpp>
+
+#if BOOST_VERSION >= 108100
+#include <boost/unordered/unordered_flat_map.hpp>
+#endif
+
+#include "type_map_benchmark_types.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef TYPE_MAP_BENCHMARK_ROWS
+#define TYPE_MAP_BENCHMARK_ROWS 160
+#endif
+
+using boost::typeindex::type_index;
+using value_type = std::pair<const type_index, int>;
+
+struct result {
+    std::string container;
+    std::size_t size;
+    double build_us;
+    double hit_ns;
+    double miss_ns;
+};
+
+std::vector<result> results;
+std::size_t lookups = 1000000;
+std::size_t sink = 0;
+
+// Best time of several runs, in nanoseconds per operation
+template <class F>
+double measure(std::size_t operations, F f) {
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        sink += f();
+        const auto finish = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / operations;
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+// Builds the container in the way it is usually filled at startup
+template <class Map>
+struct builder {
+    static Map build(const std::vector<value_type>& values) {
+        Map map;
+        for (const value_type& v : values) {
+            map.emplace(v.first, v.second);
+        }
+        return map;
+    }
+};
+
+template <class V>
+struct builder<boost::typeindex::frozen_type_map<V> > {
+    static boost::typeindex::frozen_type_map<V> build(const std::vector<value_type>& values) {
+        return boost::typeindex::frozen_type_map<V>(values.begin(), values.end());
+    }
+};
+
+template <>
+struct builder<boost::unordered_set<type_index> > {
+    static boost::unordered_set<type_index> build(const std::vector<value_type>& values) {
+        boost::unordered_set<type_index> set;
+        for (const value_type& v : values) {
+            set.insert(v.first);
+        }
+        return set;
+    }
+};
+
+template <class Map>
+std::size_t find_all(const Map& map, const std::vector<type_index>& queries) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < lookups; ++i) {
+        found += (map.find(queries[i % queries.size()]) != map.end());
+    }
+    return found;
+}
+
+// Builds the container from the first `size` types and looks up the included and the following types
+template <class Map>
+void bench(const char* container, const std::vector<type_index>& all, std::size_t size) {
+    std::vector<value_type> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        values.emplace_back(all[i], static_cast<int>(i));
+    }
+
+    benchmark_random random(size);
+    std::vector<type_index> hits;
+    std::vector<type_index> misses;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        hits.push_back(all[random(size)]);
+        if (all.size() > size) {
+            misses.push_back(all[size + random(all.size() - size)]);
+        }
+    }
+
+    const double build_us = measure(1, [&values]() { return builder<Map>::build(values).size(); }) / 1000;
+
+    const Map map = builder<Map>::build(values);
+    if (find_all(map, hits) != lookups || (!misses.empty() && find_all(map, misses) != 0)) {
+        std::cerr << "Unexpected lookup results for " << container << '\n';
+        std::exit(1);
+    }
+
+    const double hit_ns = measure(lookups, [&map, &hits]() { return find_all(map, hits); });
+    const double miss_ns = (misses.empty() ? -1 : measure(lookups, [&map, &misses]() { return find_all(map, misses); }));
+    results.push_back(result{container, size, build_us, hit_ns, miss_ns});
+}
+
+const char* mode() {
+#if defined(BOOST_NO_RTTI)
+    return "no_rtti";
+#elif defined(BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY)
+    return "rtti_ctti";
+#else
+    return "rtti";
+#endif
+}
+
+void print_json(std::size_t types) {
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"type_index\": \"" << boost::typeindex::type_id<type_index>().pretty_name() << "\",\n"
+              << "  \"types\": " << types << ",\n"
+              << "  \"lookups\": " << lookups << ",\n"
+              << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        std::cout << "    {\"container\": \"" << r.container
+                  << "\", \"size\": " << r.size
+                  << ", \"build_us\": " << r.build_us
+                  << ", \"hit_ns\": " << r.hit_ns
+                  << ", \"miss_ns\": ";
+        if (r.miss_ns < 0) {
+            std::cout << "null";
+        } else {
+            std::cout << r.miss_ns;
+        }
+        std::cout << (i + 1 == results.size() ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        lookups = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+        if (!lookups) {
+            std::cerr << "Usage: " << argv[0] << " [lookups]\n";
+            return 1;
+        }
+    }
+
+    const std::vector<type_index> types = make_benchmark_types<boost_type_keys, TYPE_MAP_BENCHMARK_ROWS>();
+    for (std::size_t size = 10; size <= types.size(); size *= 10) {
+        bench<boost::typeindex::frozen_type_map<int> >("boost::typeindex::frozen_type_map", types, size);
+        bench<boost::typeindex::type_map<int> >("boost::typeindex::type_map", types, size);
+#if BOOST_VERSION >= 108100
+        bench<boost::unordered_flat_map<type_index, int> >("boost::unordered_flat_map", types, size);
+#endif
+        bench<boost::unordered_map<type_index, int> >("boost::unordered_map", types, size);
+        bench<boost::unordered_set<type_index> >("boost::unordered_set", types, size);
+    }
+
+    print_json(types.size());
+    return 0;
+}
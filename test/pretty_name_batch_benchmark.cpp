@@ -0,0 +1,153 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures demangling of names one by one, as stl_type_index::pretty_name() does, and with
+// boost::typeindex::pretty_name_batch and prints the results as JSON to stdout.
+//
+// Usage: pretty_name_batch_benchmark [names_count]
+
+#include <boost/type_index/pretty_name_batch.hpp>
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace my_namespace {
+    template <int I>
+    struct my_class {};
+
+    template <class T, class U>
+    struct my_template {};
+}
+
+template <int I>
+void add_types(std::vector<const char*>& names) {
+    names.push_back(typeid(my_namespace::my_class<I>).name());
+    names.push_back(typeid(my_namespace::my_template<std::vector<my_namespace::my_class<I> >, std::string>).name());
+    names.push_back(typeid(std::map<int, std::shared_ptr<my_namespace::my_class<I> > >).name());
+    names.push_back(typeid(std::tuple<my_namespace::my_class<I>, const char*, double>).name());
+    add_types<I - 1>(names);
+}
+
+template <>
+void add_types<-1>(std::vector<const char*>&) {}
+
+// 256 distinct names, repeated
+std::vector<const char*> repeated_names(std::size_t count) {
+    std::vector<const char*> distinct;
+    add_types<63>(distinct);
+
+    std::vector<const char*> result(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        result[i] = distinct[(i * 31) % distinct.size()];
+    }
+    return result;
+}
+
+// All the names are different
+std::vector<const char*> unique_names(std::size_t count, std::vector<std::string>& storage) {
+    storage.resize(count);
+    std::vector<const char*> result(count);
+    char buffer[64];
+    for (std::size_t i = 0; i < count; ++i) {
+        std::snprintf(buffer, sizeof(buffer), "N12my_namespace7my_enumI20my_type_%012lluEE", static_cast<unsigned long long>(i));
+        storage[i] = buffer;
+        result[i] = storage[i].c_str();
+    }
+    return result;
+}
+
+std::size_t sink = 0;
+
+template <class F>
+double measure(F f) {
+    double best = 0;
+    for (int run = 0; run < 3; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        sink += f();
+        const auto finish = std::chrono::steady_clock::now();
+
+        const double ms = std::chrono::duration<double, std::milli>(finish - start).count();
+        if (run == 0 || ms < best) {
+            best = ms;
+        }
+    }
+    return best;
+}
+
+std::size_t per_name(const std::vector<const char*>& names) {
+    std::size_t result = 0;
+    for (const char* name : names) {
+        std::string pretty;
+        boost::typeindex::impl::append_pretty_name(name, pretty);
+        result += pretty.size();
+    }
+    return result;
+}
+
+std::size_t batch(const std::vector<const char*>& names, std::size_t threads) {
+    return boost::typeindex::pretty_name_batch(names.data(), names.size(), threads).buffer().size();
+}
+
+void report(const char* input, const std::vector<const char*>& names, std::size_t threads, bool last) {
+    const double per_name_ms = measure([&names]() { return per_name(names); });
+    const double batch_ms = measure([&names]() { return batch(names, 1); });
+    const double batch_threads_ms = measure([&names, threads]() { return batch(names, threads); });
+
+    std::cout << "    {\"input\": \"" << input
+              << "\", \"per_name_ms\": " << per_name_ms
+              << ", \"batch_ms\": " << batch_ms
+              << ", \"batch_threads_ms\": " << batch_threads_ms
+              << ", \"per_name_names_per_s\": " << static_cast<double>(names.size()) / per_name_ms * 1000
+              << ", \"batch_names_per_s\": " << static_cast<double>(names.size()) / batch_ms * 1000
+              << ", \"batch_threads_names_per_s\": " << static_cast<double>(names.size()) / batch_threads_ms * 1000
+              << (last ? "}\n" : "},\n");
+}
+
+int main(int argc, char** argv) {
+    std::size_t count = 1000000;
+    if (argc > 1) {
+        count = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+        if (!count) {
+            std::cerr << "Usage: " << argv[0] << " [names_count]\n";
+            return 1;
+        }
+    }
+
+    std::size_t threads = std::thread::hardware_concurrency();
+    if (!threads) {
+        threads = 1;
+    }
+
+    std::vector<std::string> storage;
+    const std::vector<const char*> repeated = repeated_names(count);
+    const std::vector<const char*> unique = unique_names(count, storage);
+
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"names\": " << count << ",\n"
+              << "  \"threads\": " << threads << ",\n"
+              << "  \"results\": [\n";
+    report("repeated", repeated, threads, false);
+    report("unique", unique, threads, true);
+    std::cout << "  ]\n}\n";
+
+    return sink ? 0 : 1;
+}
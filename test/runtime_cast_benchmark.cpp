@@ -0,0 +1,228 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures boost::typeindex::runtime_cast and dynamic_cast (if RTTI is enabled)
+// on synthetic class hierarchies and prints the results as JSON to stdout.
+//
+// Usage: runtime_cast_benchmark [iterations]
+//
+// Build it once with RTTI, once with RTTI and BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY
+// and once without RTTI to get the numbers for stl_type_index, ctti_type_index with
+// dynamic_cast available for comparison and ctti_type_index alone.
+
+#include <boost/type_index/runtime_cast.hpp>
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Linear chain: chain<N> -> chain<N - 1> -> ... -> chain<0>
+template <int N>
+struct chain : chain<N - 1> {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(chain<N - 1>)
+};
+
+template <>
+struct chain<0> {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~chain() {}
+};
+
+// Wide fan-out: fan<leaf<0>, ..., leaf<N>> has N + 1 polymorphic bases
+template <int N>
+struct leaf {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~leaf() {}
+};
+
+template <class... Bases>
+struct fan : Bases... {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(Bases...)
+};
+
+using wide = fan<
+    leaf<0>, leaf<1>, leaf<2>, leaf<3>, leaf<4>, leaf<5>, leaf<6>, leaf<7>,
+    leaf<8>, leaf<9>, leaf<10>, leaf<11>, leaf<12>, leaf<13>, leaf<14>, leaf<15>
+>;
+
+// Diamond without virtual inheritance: two `top` subobjects
+struct top {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~top() {}
+};
+
+struct left : top {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(top)
+};
+
+struct right : top {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(top)
+};
+
+struct bottom : left, right {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(left, right)
+};
+
+// Diamond with a virtual base: single `vtop` subobject
+struct vtop {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~vtop() {}
+};
+
+struct vleft : virtual vtop {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(vtop)
+};
+
+struct vright : virtual vtop {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(vtop)
+};
+
+struct vbottom : vleft, vright {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(vleft, vright)
+};
+
+// Not related to any of the hierarchies above, all casts to it fail
+struct unrelated {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~unrelated() {}
+};
+
+struct result {
+    std::string hierarchy;
+    std::string cast;
+    std::string method;
+    bool success;
+    double ns_per_cast;
+};
+
+std::vector<result> results;
+std::size_t iterations = 1000000;
+std::size_t sink = 0;
+int errors = 0;
+
+// Best time of several runs, in nanoseconds per cast
+template <class F>
+double measure(F f) {
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        std::size_t found = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            found += (f() != nullptr);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        sink += found;
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / iterations;
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+template <class Target, class Source>
+void bench(const char* hierarchy, const char* cast, Source* source, bool success) {
+    // Prevents the compiler from hoisting the cast out of the loop
+    Source* volatile from = source;
+
+    if ((boost::typeindex::runtime_cast<Target*>(from) != nullptr) != success) {
+        std::cerr << "Unexpected result of runtime_cast for " << hierarchy << ' ' << cast << '\n';
+        ++errors;
+    }
+    results.push_back(result{hierarchy, cast, "runtime_cast", success, measure([&from]() {
+        return boost::typeindex::runtime_cast<Target*>(from);
+    })});
+
+#ifndef BOOST_NO_RTTI
+    results.push_back(result{hierarchy, cast, "dynamic_cast", success, measure([&from]() {
+        return dynamic_cast<Target*>(from);
+    })});
+#endif
+}
+
+const char* mode() {
+#if defined(BOOST_NO_RTTI)
+    return "no_rtti";
+#elif defined(BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY)
+    return "rtti_ctti";
+#else
+    return "rtti";
+#endif
+}
+
+void print_json() {
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"type_index\": \"" << boost::typeindex::type_id<boost::typeindex::type_index>().pretty_name() << "\",\n"
+              << "  \"iterations\": " << iterations << ",\n"
+              << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        std::cout << "    {\"hierarchy\": \"" << r.hierarchy
+                  << "\", \"cast\": \"" << r.cast
+                  << "\", \"method\": \"" << r.method
+                  << "\", \"success\": " << (r.success ? "true" : "false")
+                  << ", \"ns_per_cast\": " << r.ns_per_cast
+                  << (i + 1 == results.size() ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        iterations = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+        if (!iterations) {
+            std::cerr << "Usage: " << argv[0] << " [iterations]\n";
+            return 1;
+        }
+    }
+
+    chain<1> chain_1;
+    bench<chain<1> >("chain_1", "down_to_dynamic", static_cast<chain<0>*>(&chain_1), true);
+    bench<unrelated>("chain_1", "unrelated", static_cast<chain<0>*>(&chain_1), false);
+
+    chain<4> chain_4;
+    bench<chain<4> >("chain_4", "down_to_dynamic", static_cast<chain<0>*>(&chain_4), true);
+    bench<chain<2> >("chain_4", "down_to_middle", static_cast<chain<0>*>(&chain_4), true);
+    bench<unrelated>("chain_4", "unrelated", static_cast<chain<0>*>(&chain_4), false);
+
+    chain<16> chain_16;
+    bench<chain<16> >("chain_16", "down_to_dynamic", static_cast<chain<0>*>(&chain_16), true);
+    bench<chain<8> >("chain_16", "down_to_middle", static_cast<chain<0>*>(&chain_16), true);
+    bench<unrelated>("chain_16", "unrelated", static_cast<chain<0>*>(&chain_16), false);
+
+    chain<8> chain_8;
+    bench<chain<16> >("chain_8", "down_past_dynamic", static_cast<chain<0>*>(&chain_8), false);
+
+    wide w;
+    bench<wide>("wide_16", "down_to_dynamic", static_cast<leaf<0>*>(&w), true);
+    bench<leaf<1> >("wide_16", "cross_to_first", static_cast<leaf<0>*>(&w), true);
+    bench<leaf<15> >("wide_16", "cross_to_last", static_cast<leaf<0>*>(&w), true);
+    bench<unrelated>("wide_16", "unrelated", static_cast<leaf<0>*>(&w), false);
+
+    bottom b;
+    bench<bottom>("diamond", "down_to_dynamic", static_cast<top*>(static_cast<left*>(&b)), true);
+    bench<right>("diamond", "cross", static_cast<left*>(&b), true);
+    bench<unrelated>("diamond", "unrelated", static_cast<top*>(static_cast<left*>(&b)), false);
+
+    vbottom vb;
+    bench<vbottom>("virtual_diamond", "down_to_dynamic", static_cast<vtop*>(&vb), true);
+    bench<vright>("virtual_diamond", "cross", static_cast<vleft*>(&vb), true);
+    bench<vright>("virtual_diamond", "down_from_virtual_base", static_cast<vtop*>(&vb), true);
+    bench<unrelated>("virtual_diamond", "unrelated", static_cast<vtop*>(&vb), false);
+
+    print_json();
+    return errors;
+}
@@ -0,0 +1,209 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures failed casts of references with 1 to max_threads threads: boost::typeindex::runtime_cast<T&> that
+// throws boost::typeindex::bad_runtime_cast, boost::typeindex::try_runtime_reference_cast<T> (C++17) that returns
+// an empty std::optional, and dynamic_cast<T&> that throws std::bad_cast (if RTTI is enabled). Failed
+// boost::typeindex::runtime_cast<T*> is measured as the lower bound. Prints the results as JSON to stdout.
+//
+// Unwinding of the stack on some platforms takes a process wide lock, so the throwing casts could scale worse
+// than the non throwing ones.
+//
+// Usage: runtime_cast_failure_benchmark [max_threads [casts_per_thread]]
+
+#include <boost/type_index/runtime_cast.hpp>
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+struct base {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~base() {}
+};
+
+struct middle : base {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(base)
+};
+
+struct derived : middle {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(middle)
+};
+
+// Not related to the hierarchy above, all casts to it fail
+struct unrelated {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~unrelated() {}
+};
+
+struct result {
+    std::string method;
+    std::size_t threads;
+    double ns_per_cast;
+    double total_mops;
+};
+
+std::vector<result> results;
+std::size_t casts = 100000;
+int errors = 0;
+
+// Each function returns the count of the failed casts
+std::size_t runtime_cast_throw(base* const volatile& from) {
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < casts; ++i) {
+        try {
+            boost::typeindex::runtime_cast<unrelated&>(*from);
+        } catch (const boost::typeindex::bad_runtime_cast&) {
+            ++failed;
+        }
+    }
+    return failed;
+}
+
+#ifndef BOOST_NO_CXX17_HDR_OPTIONAL
+std::size_t try_runtime_reference_cast(base* const volatile& from) {
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < casts; ++i) {
+        failed += !boost::typeindex::try_runtime_reference_cast<unrelated>(*from);
+    }
+    return failed;
+}
+#endif
+
+std::size_t runtime_cast_pointer(base* const volatile& from) {
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < casts; ++i) {
+        failed += !boost::typeindex::runtime_cast<unrelated*>(from);
+    }
+    return failed;
+}
+
+#ifndef BOOST_NO_RTTI
+std::size_t dynamic_cast_throw(base* const volatile& from) {
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < casts; ++i) {
+        try {
+            (void)dynamic_cast<unrelated&>(*from);
+        } catch (const std::bad_cast&) {
+            ++failed;
+        }
+    }
+    return failed;
+}
+#endif
+
+void bench(const char* method, std::size_t threads, std::size_t (*f)(base* const volatile&)) {
+    double best = 0;
+    for (int run = 0; run < 3; ++run) {
+        std::atomic<std::size_t> ready{0};
+        std::atomic<bool> start{false};
+        std::atomic<std::size_t> failed{0};
+
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&]() {
+                derived d;
+                // Prevents the compiler from hoisting the cast out of the loop
+                base* const volatile from = &d;
+
+                ++ready;
+                while (!start) {
+                    std::this_thread::yield();
+                }
+                failed += f(from);
+            });
+        }
+
+        while (ready != threads) {
+            std::this_thread::yield();
+        }
+        const auto begin = std::chrono::steady_clock::now();
+        start = true;
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+
+        if (failed != threads * casts) {
+            std::cerr << "Unexpected results of " << method << '\n';
+            ++errors;
+        }
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - begin).count() / casts;
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+
+    // Wall time of a single cast as seen by each thread, and the total throughput
+    results.push_back(result{method, threads, best, threads * 1000.0 / best});
+}
+
+const char* mode() {
+#if defined(BOOST_NO_RTTI)
+    return "no_rtti";
+#elif defined(BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY)
+    return "rtti_ctti";
+#else
+    return "rtti";
+#endif
+}
+
+void print_json() {
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n"
+              << "  \"casts_per_thread\": " << casts << ",\n"
+              << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        std::cout << "    {\"method\": \"" << r.method
+                  << "\", \"threads\": " << r.threads
+                  << ", \"ns_per_cast\": " << r.ns_per_cast
+                  << ", \"total_mops\": " << r.total_mops
+                  << (i + 1 == results.size() ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t max_threads = 8;
+    if (argc > 1) {
+        max_threads = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+    if (argc > 2) {
+        casts = static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10));
+    }
+    if (!max_threads || !casts) {
+        std::cerr << "Usage: " << argv[0] << " [max_threads [casts_per_thread]]\n";
+        return 1;
+    }
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        bench("runtime_cast<T&> throw", threads, &runtime_cast_throw);
+#ifndef BOOST_NO_CXX17_HDR_OPTIONAL
+        bench("try_runtime_reference_cast", threads, &try_runtime_reference_cast);
+#endif
+        bench("runtime_cast<T*>", threads, &runtime_cast_pointer);
+#ifndef BOOST_NO_RTTI
+        bench("dynamic_cast<T&> throw", threads, &dynamic_cast_throw);
+#endif
+    }
+
+    print_json();
+    return errors;
+}
@@ -0,0 +1,239 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares boost::typeindex::runtime_cast_filter with a loop of boost::typeindex::runtime_cast calls and
+// with a loop of dynamic_cast calls (if RTTI is enabled) on a large collection of objects scattered in memory.
+// Objects are of a single type, of a few types, of many types or of one dominant type with a long tail.
+// Prints the results as JSON to stdout.
+//
+// Usage: runtime_cast_filter_benchmark [objects [rounds]]
+
+#include <boost/type_index/runtime_cast.hpp>
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+
+#include "type_map_benchmark_types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+struct shape {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~shape() {}
+};
+
+// Target of the casts, half of the kinds derive from it
+struct rounded : shape {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(shape)
+};
+
+template <int N>
+struct kind : std::conditional<N % 2 == 0, rounded, shape>::type {
+    using base_type = typename std::conditional<N % 2 == 0, rounded, shape>::type;
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(base_type)
+
+    // Some payload, so that the objects do not share cache lines
+    char payload[48] = {};
+};
+
+constexpr int kinds_count = 64;
+
+using factory = shape* (*)();
+
+template <int N>
+shape* make_kind() {
+    return new kind<N>();
+}
+
+template <int N>
+struct factories {
+    static void add(std::vector<factory>& v) {
+        factories<N - 1>::add(v);
+        v.push_back(&make_kind<N - 1>);
+    }
+};
+
+template <>
+struct factories<0> {
+    static void add(std::vector<factory>&) {}
+};
+
+struct result {
+    std::string distribution;
+    std::string method;
+    std::size_t kinds;
+    double ns_per_object;
+};
+
+std::vector<result> results;
+std::size_t objects_count = 1 << 20;
+std::size_t rounds = 5;
+int errors = 0;
+
+struct by_runtime_cast_filter {
+    static const char* name() noexcept { return "runtime_cast_filter"; }
+
+    static void filter(const std::vector<shape*>& in, std::vector<rounded*>& out) {
+        boost::typeindex::runtime_cast_filter<rounded>(in.begin(), in.end(), std::back_inserter(out));
+    }
+};
+
+struct by_runtime_cast {
+    static const char* name() noexcept { return "runtime_cast_loop"; }
+
+    static void filter(const std::vector<shape*>& in, std::vector<rounded*>& out) {
+        for (shape* s : in) {
+            if (rounded* r = boost::typeindex::runtime_cast<rounded*>(s)) {
+                out.push_back(r);
+            }
+        }
+    }
+};
+
+#ifndef BOOST_NO_RTTI
+struct by_dynamic_cast {
+    static const char* name() noexcept { return "dynamic_cast_loop"; }
+
+    static void filter(const std::vector<shape*>& in, std::vector<rounded*>& out) {
+        for (shape* s : in) {
+            if (rounded* r = dynamic_cast<rounded*>(s)) {
+                out.push_back(r);
+            }
+        }
+    }
+};
+#endif
+
+template <class Method>
+void bench(const char* distribution, std::size_t kinds, const std::vector<shape*>& in, const std::vector<rounded*>& expected) {
+    std::vector<rounded*> out;
+    out.reserve(in.size());
+
+    double best = 0;
+    for (std::size_t run = 0; run < rounds; ++run) {
+        out.clear();
+        const auto start = std::chrono::steady_clock::now();
+        Method::filter(in, out);
+        const auto finish = std::chrono::steady_clock::now();
+
+        if (out != expected) {
+            std::cerr << "Unexpected result of " << Method::name() << " for " << distribution << '\n';
+            ++errors;
+        }
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / in.size();
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    results.push_back(result{distribution, Method::name(), kinds, best});
+}
+
+// `pick` returns the index of the kind of the next object
+template <class Pick>
+void bench_distribution(const char* distribution, Pick pick) {
+    std::vector<factory> makers;
+    factories<kinds_count>::add(makers);
+
+    // Objects are allocated in a random order of their kinds, so that the neighbours in
+    // memory have different dynamic types, and then are shuffled once more
+    benchmark_random random(objects_count);
+    std::vector<std::unique_ptr<shape> > objects;
+    std::vector<bool> used(kinds_count);
+    objects.reserve(objects_count);
+    for (std::size_t i = 0; i < objects_count; ++i) {
+        const std::size_t index = pick(random);
+        used[index] = true;
+        objects.emplace_back(makers[index]());
+    }
+
+    std::vector<shape*> in;
+    in.reserve(objects.size());
+    for (const std::unique_ptr<shape>& p : objects) {
+        in.push_back(p.get());
+    }
+    for (std::size_t i = in.size(); i > 1; --i) {
+        std::swap(in[i - 1], in[random(i)]);
+    }
+
+    std::vector<rounded*> expected;
+    by_runtime_cast::filter(in, expected);
+
+    const std::size_t kinds = static_cast<std::size_t>(std::count(used.begin(), used.end(), true));
+    bench<by_runtime_cast_filter>(distribution, kinds, in, expected);
+    bench<by_runtime_cast>(distribution, kinds, in, expected);
+#ifndef BOOST_NO_RTTI
+    bench<by_dynamic_cast>(distribution, kinds, in, expected);
+#endif
+}
+
+const char* mode() {
+#if defined(BOOST_NO_RTTI)
+    return "no_rtti";
+#elif defined(BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY)
+    return "rtti_ctti";
+#else
+    return "rtti";
+#endif
+}
+
+void print_json() {
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"objects\": " << objects_count << ",\n"
+              << "  \"rounds\": " << rounds << ",\n"
+              << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        std::cout << "    {\"distribution\": \"" << r.distribution
+                  << "\", \"kinds\": " << r.kinds
+                  << ", \"method\": \"" << r.method
+                  << "\", \"ns_per_object\": " << r.ns_per_object
+                  << (i + 1 == results.size() ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        objects_count = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+    if (argc > 2) {
+        rounds = static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10));
+    }
+    if (!objects_count || !rounds) {
+        std::cerr << "Usage: " << argv[0] << " [objects [rounds]]\n";
+        return 1;
+    }
+
+    bench_distribution("single", [](benchmark_random&) -> std::size_t {
+        return 0;
+    });
+    bench_distribution("few", [](benchmark_random& random) {
+        return random(4);
+    });
+    bench_distribution("many", [](benchmark_random& random) {
+        return random(kinds_count);
+    });
+    bench_distribution("skewed", [](benchmark_random& random) {
+        // 90% of the objects are of the same type
+        return random(10) ? 0 : 1 + random(kinds_count - 1);
+    });
+
+    print_json();
+    return errors;
+}
@@ -0,0 +1,246 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures boost::typeindex::runtime_cast to the leaf classes of leaf heavy hierarchies, like the nodes
+// of an AST or the types of messages, with the leaves marked `final` and without it. Each object of a
+// shuffled collection is dispatched by a chain of casts to all the leaf types, so most of the casts fail.
+// dynamic_cast (if RTTI is enabled) is measured for comparison. Prints the results as JSON to stdout.
+//
+// Usage: runtime_cast_final_benchmark [rounds]
+
+#include <boost/type_index/runtime_cast.hpp>
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+
+#include "type_map_benchmark_types.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define BENCHMARK_AST(NAMESPACE, FINAL)                                         \
+    namespace NAMESPACE {                                                       \
+    struct node {                                                               \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()                               \
+        virtual ~node() {}                                                      \
+    };                                                                          \
+    struct expression : node { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(node) }; \
+    struct statement : node { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(node) };  \
+    struct literal FINAL : expression {                                         \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(expression)                     \
+    };                                                                          \
+    struct identifier FINAL : expression {                                      \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(expression)                     \
+    };                                                                          \
+    struct unary FINAL : expression {                                           \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(expression)                     \
+    };                                                                          \
+    struct binary FINAL : expression {                                          \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(expression)                     \
+    };                                                                          \
+    struct call FINAL : expression {                                            \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(expression)                     \
+    };                                                                          \
+    struct block FINAL : statement {                                            \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(statement)                      \
+    };                                                                          \
+    struct if_statement FINAL : statement {                                     \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(statement)                      \
+    };                                                                          \
+    struct return_statement FINAL : statement {                                 \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(statement)                      \
+    };                                                                          \
+    using base = node;                                                          \
+    using leaves = leaf_list<literal, identifier, unary, binary, call,          \
+        block, if_statement, return_statement>;                                 \
+    }
+
+// Messages are deeper and have an additional base, so the tables of the leaves are longer
+#define BENCHMARK_MESSAGES(NAMESPACE, FINAL)                                                    \
+    namespace NAMESPACE {                                                                       \
+    struct message {                                                                            \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()                                               \
+        virtual ~message() {}                                                                   \
+    };                                                                                          \
+    struct serializable {                                                                       \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()                                               \
+        virtual ~serializable() {}                                                              \
+    };                                                                                          \
+    struct routed : message, serializable {                                                     \
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(message, serializable)                          \
+    };                                                                                          \
+    struct request : routed { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(routed) };                \
+    struct response : routed { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(routed) };               \
+    struct get FINAL : request { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(request) };             \
+    struct put FINAL : request { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(request) };             \
+    struct erase FINAL : request { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(request) };           \
+    struct subscribe FINAL : request { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(request) };       \
+    struct ok FINAL : response { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(response) };            \
+    struct not_found FINAL : response { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(response) };     \
+    struct redirect FINAL : response { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(response) };      \
+    struct failure FINAL : response { BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(response) };       \
+    using base = message;                                                                       \
+    using leaves = leaf_list<get, put, erase, subscribe, ok, not_found, redirect, failure>;     \
+    }
+
+template <class... Leaves>
+struct leaf_list {};
+
+BENCHMARK_AST(ast_final, final)
+BENCHMARK_AST(ast_plain, )
+BENCHMARK_MESSAGES(messages_final, final)
+BENCHMARK_MESSAGES(messages_plain, )
+
+struct result {
+    std::string hierarchy;
+    std::string method;
+    bool leaves_final;
+    double ns_per_object;
+};
+
+std::vector<result> results;
+std::size_t rounds = 1000;
+std::size_t sink = 0;
+int errors = 0;
+
+struct by_runtime_cast {
+    static const char* name() noexcept { return "runtime_cast"; }
+
+    template <class Leaf, class Base>
+    static bool is(Base* p) noexcept { return boost::typeindex::runtime_cast<Leaf*>(p) != nullptr; }
+};
+
+#ifndef BOOST_NO_RTTI
+struct by_dynamic_cast {
+    static const char* name() noexcept { return "dynamic_cast"; }
+
+    template <class Leaf, class Base>
+    static bool is(Base* p) noexcept { return dynamic_cast<Leaf*>(p) != nullptr; }
+};
+#endif
+
+// Index of the first leaf type that the object is an instance of
+template <class Method, class Base>
+std::size_t dispatch(Base*, leaf_list<>) noexcept {
+    return 0;
+}
+
+template <class Method, class Base, class Leaf, class... Leaves>
+std::size_t dispatch(Base* p, leaf_list<Leaf, Leaves...>) noexcept {
+    return Method::template is<Leaf>(p) ? 0 : 1 + dispatch<Method>(p, leaf_list<Leaves...>());
+}
+
+template <class Base>
+void add_objects(std::vector<std::unique_ptr<Base> >&, leaf_list<>) {}
+
+template <class Base, class Leaf, class... Leaves>
+void add_objects(std::vector<std::unique_ptr<Base> >& objects, leaf_list<Leaf, Leaves...>) {
+    objects.emplace_back(new Leaf());
+    add_objects(objects, leaf_list<Leaves...>());
+}
+
+template <class Method, class Base, class Leaves>
+void bench(const char* hierarchy, bool leaves_final) {
+    std::vector<std::unique_ptr<Base> > objects;
+    add_objects(objects, Leaves());
+
+    // Shuffled objects, so that the branch predictor does not learn the order of the types
+    benchmark_random random(42);
+    std::vector<Base*> sequence;
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        const std::size_t index = random(objects.size());
+        sequence.push_back(objects[index].get());
+        expected.push_back(index);
+    }
+
+    for (std::size_t i = 0; i < sequence.size(); ++i) {
+        if (dispatch<Method>(sequence[i], Leaves()) != expected[i]) {
+            std::cerr << "Unexpected result of " << Method::name() << " for " << hierarchy << '\n';
+            ++errors;
+            return;
+        }
+    }
+
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        std::size_t sum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < rounds; ++r) {
+            for (Base* p : sequence) {
+                sum += dispatch<Method>(p, Leaves());
+            }
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        sink += sum;
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / (rounds * sequence.size());
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    results.push_back(result{hierarchy, Method::name(), leaves_final, best});
+}
+
+template <class Method>
+void bench_all() {
+    bench<Method, ast_final::base, ast_final::leaves>("ast", true);
+    bench<Method, ast_plain::base, ast_plain::leaves>("ast", false);
+    bench<Method, messages_final::base, messages_final::leaves>("messages", true);
+    bench<Method, messages_plain::base, messages_plain::leaves>("messages", false);
+}
+
+const char* mode() {
+#if defined(BOOST_NO_RTTI)
+    return "no_rtti";
+#elif defined(BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY)
+    return "rtti_ctti";
+#else
+    return "rtti";
+#endif
+}
+
+void print_json() {
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"final_fast_path\": " << (boost::typeindex::detail::runtime_cast_is_leaf<ast_final::literal>::value ? "true" : "false") << ",\n"
+              << "  \"rounds\": " << rounds << ",\n"
+              << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        std::cout << "    {\"hierarchy\": \"" << r.hierarchy
+                  << "\", \"method\": \"" << r.method
+                  << "\", \"leaves_final\": " << (r.leaves_final ? "true" : "false")
+                  << ", \"ns_per_object\": " << r.ns_per_object
+                  << (i + 1 == results.size() ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        rounds = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+        if (!rounds) {
+            std::cerr << "Usage: " << argv[0] << " [rounds]\n";
+            return 1;
+        }
+    }
+
+    bench_all<by_runtime_cast>();
+#ifndef BOOST_NO_RTTI
+    bench_all<by_dynamic_cast>();
+#endif
+
+    print_json();
+    return errors;
+}
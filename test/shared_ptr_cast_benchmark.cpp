@@ -0,0 +1,200 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures boost::typeindex::runtime_pointer_cast of std::shared_ptr and boost::shared_ptr rvalues and lvalues
+// with 1 to max_threads threads that cast pointers to the same object, so that all the threads modify the
+// same reference counter. Prints the results as JSON to stdout.
+//
+// Each iteration copies the shared source pointer and casts the copy:
+// * lvalue cast: copy, cast, destruction of the copy, destruction of the result - 4 atomic operations;
+// * rvalue cast: copy, cast that takes the ownership from the copy, destruction of the result - 2 atomic
+//   operations (for std::shared_ptr only since C++20, before that it is the same as the lvalue cast).
+//
+// Usage: shared_ptr_cast_benchmark [max_threads [iterations_per_thread]]
+
+#include <boost/type_index/runtime_cast.hpp>
+#include <boost/type_index/runtime_cast/boost_shared_ptr_cast.hpp>
+#include <boost/type_index/runtime_cast/std_shared_ptr_cast.hpp>
+#include <boost/config.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct message {
+    BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS()
+    virtual ~message() {}
+};
+
+struct request : message {
+    BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS(message)
+};
+
+struct ping : request {
+    BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS(request)
+};
+
+struct result {
+    std::string pointer;
+    std::string method;
+    std::size_t threads;
+    double ns_per_cast;
+};
+
+std::vector<result> results;
+std::size_t iterations = 1000000;
+int errors = 0;
+
+// Each function returns the count of successful casts
+template <class Ptr>
+std::size_t cast_lvalues(const Ptr& source) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Ptr copy = source;
+        found += !!boost::typeindex::runtime_pointer_cast<request>(copy);
+    }
+    return found;
+}
+
+template <class Ptr>
+std::size_t cast_rvalues(const Ptr& source) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Ptr copy = source;
+        found += !!boost::typeindex::runtime_pointer_cast<request>(std::move(copy));
+    }
+    return found;
+}
+
+#ifndef BOOST_NO_RTTI
+template <class Ptr>
+std::size_t dynamic_cast_lvalues(const Ptr& source) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Ptr copy = source;
+        found += !!std::dynamic_pointer_cast<request>(copy);
+    }
+    return found;
+}
+#endif
+
+// Wall time of a single cast as seen by each of the threads
+template <class Ptr>
+double measure(const Ptr& source, std::size_t threads, std::size_t (*f)(const Ptr&)) {
+    double best = 0;
+    for (int run = 0; run < 3; ++run) {
+        std::atomic<std::size_t> ready{0};
+        std::atomic<bool> start{false};
+        std::atomic<std::size_t> found{0};
+
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&]() {
+                ++ready;
+                while (!start) {
+                    std::this_thread::yield();
+                }
+                found += f(source);
+            });
+        }
+
+        while (ready != threads) {
+            std::this_thread::yield();
+        }
+        const auto begin = std::chrono::steady_clock::now();
+        start = true;
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+
+        if (found != threads * iterations || source.use_count() != 1) {
+            std::cerr << "Unexpected results of the casts\n";
+            ++errors;
+        }
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - begin).count() / iterations;
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+template <class Ptr>
+void bench(const char* pointer, const Ptr& source, std::size_t threads) {
+    results.push_back(result{pointer, "runtime_pointer_cast(const&)", threads, measure<Ptr>(source, threads, &cast_lvalues<Ptr>)});
+    results.push_back(result{pointer, "runtime_pointer_cast(&&)", threads, measure<Ptr>(source, threads, &cast_rvalues<Ptr>)});
+}
+
+const char* mode() {
+#if defined(BOOST_NO_RTTI)
+    return "no_rtti";
+#elif defined(BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY)
+    return "rtti_ctti";
+#else
+    return "rtti";
+#endif
+}
+
+void print_json() {
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"cplusplus\": " << __cplusplus << ",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n"
+              << "  \"iterations_per_thread\": " << iterations << ",\n"
+              << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        std::cout << "    {\"pointer\": \"" << r.pointer
+                  << "\", \"method\": \"" << r.method
+                  << "\", \"threads\": " << r.threads
+                  << ", \"ns_per_cast\": " << r.ns_per_cast
+                  << (i + 1 == results.size() ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t max_threads = 8;
+    if (argc > 1) {
+        max_threads = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+    if (argc > 2) {
+        iterations = static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10));
+    }
+    if (!max_threads || !iterations) {
+        std::cerr << "Usage: " << argv[0] << " [max_threads [iterations_per_thread]]\n";
+        return 1;
+    }
+
+    const std::shared_ptr<message> std_source = std::make_shared<ping>();
+    const boost::shared_ptr<message> boost_source = boost::make_shared<ping>();
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        bench("std::shared_ptr", std_source, threads);
+#ifndef BOOST_NO_RTTI
+        results.push_back(result{"std::shared_ptr", "std::dynamic_pointer_cast(const&)", threads,
+            measure<std::shared_ptr<message> >(std_source, threads, &dynamic_cast_lvalues<std::shared_ptr<message> >)
+        });
+#endif
+        bench("boost::shared_ptr", boost_source, threads);
+    }
+
+    print_json();
+    return errors;
+}
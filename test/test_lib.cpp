@@ -31,6 +31,11 @@ boost::typeindex::type_index get_const_user_defined_class() {
     return boost::typeindex::type_id_with_cvr<const user_defined_namespace::user_defined>();
 }
 
+const runtime_cast_base& get_runtime_cast_derived() {
+    static const runtime_cast_derived instance;
+    return instance;
+}
+
 #if !defined(BOOST_HAS_PRAGMA_DETECT_MISMATCH) || !defined(_CPPRTTI)
 // Just do nothing
 void accept_typeindex(const boost::typeindex::type_index&) {}
@@ -15,6 +15,9 @@
 #endif
 
 #include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast.hpp>
+
+#include <string>
 
 // This is ALWAYS a dynamic library
 #if defined(TEST_LIB_SOURCE)
@@ -25,12 +28,35 @@
 
 namespace test_lib {
 
+struct runtime_cast_base {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~runtime_cast_base() {}
+};
+
+struct runtime_cast_other {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~runtime_cast_other() {}
+};
+
+struct runtime_cast_derived : runtime_cast_base, runtime_cast_other {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(runtime_cast_base, runtime_cast_other)
+    std::string name = "runtime_cast_derived";
+};
+
+struct runtime_cast_unrelated {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~runtime_cast_unrelated() {}
+};
+
 TEST_LIB_DECL boost::typeindex::type_index get_integer();
 TEST_LIB_DECL boost::typeindex::type_index get_user_defined_class();
 
 TEST_LIB_DECL boost::typeindex::type_index get_const_integer();
 TEST_LIB_DECL boost::typeindex::type_index get_const_user_defined_class();
 
+// Object is constructed in the library, so it uses the library's copies of the runtime_cast tables
+TEST_LIB_DECL const runtime_cast_base& get_runtime_cast_derived();
+
 #if !defined(BOOST_HAS_PRAGMA_DETECT_MISMATCH) || !defined(_CPPRTTI)
 // This is required for checking RTTI on/off linkage
 TEST_LIB_DECL void accept_typeindex(const boost::typeindex::type_index&);
@@ -48,9 +48,48 @@ void comparing_types_between_modules()
     #endif
 }
 
+void interned_names_between_modules()
+{
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_INTERNING)
+    // Modules are built with hidden visibility, so each of them has its own copy
+    // of the names. Interning makes all of them point to a single copy.
+    BOOST_TEST(boost::typeindex::type_id<int>().raw_name() == test_lib::get_integer().raw_name());
+    BOOST_TEST(
+        boost::typeindex::type_id_with_cvr<const int>().raw_name()
+        == test_lib::get_const_integer().raw_name()
+    );
+    BOOST_TEST(
+        boost::typeindex::type_id<user_defined_namespace::user_defined>().raw_name()
+        == test_lib::get_user_defined_class().raw_name()
+    );
+#endif
+}
+
+void runtime_cast_between_modules()
+{
+    using namespace boost::typeindex;
+
+    // Types are compared with the types from the tables of the library, that
+    // may have their own copies of the type_info or names
+    const test_lib::runtime_cast_base& b = test_lib::get_runtime_cast_derived();
+    const test_lib::runtime_cast_derived* d = runtime_cast<const test_lib::runtime_cast_derived*>(&b);
+    BOOST_TEST(d);
+    BOOST_TEST_EQ(d->name, "runtime_cast_derived");
+    BOOST_TEST_EQ(&runtime_cast<const test_lib::runtime_cast_derived&>(b), d);
+
+    const test_lib::runtime_cast_other* o = runtime_pointer_cast<test_lib::runtime_cast_other>(&b);
+    BOOST_TEST_EQ(o, static_cast<const test_lib::runtime_cast_other*>(d));
+    BOOST_TEST_EQ(runtime_pointer_cast<test_lib::runtime_cast_base>(o), &b);
+
+    BOOST_TEST(runtime_is<test_lib::runtime_cast_other>(b));
+    BOOST_TEST(!runtime_is<test_lib::runtime_cast_unrelated>(b));
+    BOOST_TEST(!runtime_pointer_cast<test_lib::runtime_cast_unrelated>(&b));
+}
 
 int main() {
     comparing_types_between_modules();
+    interned_names_between_modules();
+    runtime_cast_between_modules();
 
     return boost::report_errors();
 }
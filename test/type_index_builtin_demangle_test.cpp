@@ -0,0 +1,214 @@
+//
+// Copyright 2012-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Must be compiled with BOOST_TYPE_INDEX_BUILTIN_DEMANGLE defined
+
+#include <boost/type_index.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_BUILTIN_DEMANGLE) && defined(__GLIBCXX__)
+
+#include <boost/type_index/detail/itanium_demangle.hpp>
+
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <cxxabi.h>
+
+namespace my_namespace {
+    struct my_class {};
+
+    template <class... T>
+    struct my_template {};
+
+    template <int I, unsigned U, long L, unsigned long UL, long long LL, unsigned long long ULL, bool B, char C>
+    struct my_values {};
+
+    enum my_enum { my_enum_value = 2 };
+
+    template <my_enum E>
+    struct my_enum_template {};
+
+    namespace inner {
+        template <class T, class U>
+        struct my_pair {
+            template <class V>
+            struct nested {};
+        };
+    }
+}
+
+namespace {
+    struct anonymous_class {};
+}
+
+std::string builtin_demangle(const char* mangled) {
+    char buffer[boost::typeindex::detail::itanium_demangle_buffer_size];
+    const std::size_t length = boost::typeindex::detail::itanium_type_demangler(mangled, buffer, sizeof(buffer)).demangle();
+    return std::string(buffer, length);
+}
+
+std::string cxa_demangle(const char* mangled) {
+    int status = 0;
+    char* const demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    BOOST_TEST(demangled);
+    const std::string result = demangled ? demangled : "";
+    std::free(demangled);
+    return result;
+}
+
+// Name must be demangled by the builtin demangler and the result must be the same as of __cxa_demangle
+void test_same(const char* mangled) {
+    const std::string builtin = builtin_demangle(mangled);
+    if (builtin.empty()) {
+        BOOST_ERROR(mangled);
+        return;
+    }
+    BOOST_TEST_EQ(builtin, cxa_demangle(mangled));
+}
+
+template <class T>
+void test_same_type() {
+    test_same(typeid(T).name());
+}
+
+// Name must be left for __cxa_demangle
+void test_unsupported(const char* mangled) {
+    BOOST_TEST_EQ(builtin_demangle(mangled), "");
+}
+
+// Same as stl_type_index::pretty_name() without the builtin demangler
+template <class T>
+std::string cxa_pretty_name() {
+    const std::string name = cxa_demangle(typeid(boost::typeindex::detail::cvr_saver<T>).name());
+    std::string::size_type begin = name.find('<') + 1;
+    std::string::size_type end = name.rfind('>');
+    while (name[begin] == ' ') {
+        ++begin;
+    }
+    while (name[end - 1] == ' ') {
+        --end;
+    }
+    return name.substr(begin, end - begin);
+}
+
+template <class T>
+void test_pretty_name() {
+    BOOST_TEST(!builtin_demangle(typeid(boost::typeindex::detail::cvr_saver<T>).name()).empty());
+    BOOST_TEST_EQ(boost::typeindex::type_id_with_cvr<T>().pretty_name(), cxa_pretty_name<T>());
+}
+
+void same_as_cxa_demangle() {
+    test_same_type<int>();
+    test_same_type<unsigned long long>();
+    test_same_type<char16_t>();
+    test_same_type<std::nullptr_t>();
+    test_same_type<my_namespace::my_class>();
+    test_same_type<my_namespace::my_class*>();
+    test_same_type<const my_namespace::my_class* const*>();
+    test_same_type<my_namespace::my_template<> >();
+    test_same_type<my_namespace::my_template<int, const char*, volatile int*> >();
+    test_same_type<my_namespace::my_template<my_namespace::my_class, my_namespace::my_class*> >();
+    test_same_type<my_namespace::my_values<-1, 2, -3, 4, 5, 6, true, 'A'> >();
+    test_same_type<my_namespace::my_enum_template<my_namespace::my_enum_value> >();
+    test_same_type<my_namespace::inner::my_pair<int, my_namespace::my_class> >();
+    test_same_type<my_namespace::inner::my_pair<int, char>::nested<my_namespace::inner::my_pair<int, char> > >();
+    test_same_type<anonymous_class>();
+    test_same_type<my_namespace::my_template<anonymous_class, anonymous_class*> >();
+
+    test_same_type<std::string>();
+    test_same_type<std::vector<int> >();
+    test_same_type<std::vector<std::vector<std::string> > >();
+    test_same_type<std::map<std::string, std::vector<int> > >();
+    test_same_type<std::pair<const std::string, std::shared_ptr<my_namespace::my_class> > >();
+    test_same_type<std::tuple<> >();
+    test_same_type<std::tuple<int, char, std::tuple<my_namespace::my_class> > >();
+    test_same_type<std::unique_ptr<std::map<int, std::pair<std::string, std::string> > > >();
+
+    // Hand written names with substitutions, packs and literals
+    test_same("PKc");
+    test_same("VKi");
+    test_same("KPi");
+    test_same("RKSt6vectorIiSaIiEE");
+    test_same("OSt6vectorIiSaIiEE");
+    test_same("N1a1b1cE");
+    test_same("N1a1bIiEE");
+    test_same("N1a1b1cIS_S0_S1_EE");
+    test_same("N1a1bIiE1cIS1_S2_EE");
+    test_same("3fooIS_E");
+    test_same("3fooIPS_PKS_S1_S2_E");
+    test_same("3fooIiJEE");
+    test_same("3fooIJEiE");
+    test_same("3fooIJicEE");
+    test_same("3fooILb2EE");
+    test_same("3fooILc65EiE");
+    test_same("3fooILin5EE");
+    test_same("3fooILln5EE");
+    test_same("3fooIL3bar7EE");
+    test_same("3fooI3barIS0_EE");
+    test_same("N12_GLOBAL__N_13fooE");
+    test_same("St4pairIiiE");
+    test_same("NSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE");
+}
+
+void unsupported_constructs() {
+    test_unsupported("");
+    test_unsupported("A3_i");
+    test_unsupported("FviE");
+    test_unsupported("M3fooi");
+    test_unsupported("Z4mainE3foo");
+    test_unsupported("3fooIXadL_Z3barEEE");
+    test_unsupported("3fooIT_E");
+    test_unsupported("3fooIiE_");
+    test_unsupported("3fo");
+    test_unsupported("3fooIS_");
+    test_unsupported("rVKi");
+    test_unsupported("Ss");
+}
+
+void pretty_names() {
+    test_pretty_name<int>();
+    test_pretty_name<const int>();
+    test_pretty_name<const volatile int&>();
+    test_pretty_name<int&&>();
+    test_pretty_name<my_namespace::my_class>();
+    test_pretty_name<const my_namespace::my_class&>();
+    test_pretty_name<std::vector<int> >();
+    test_pretty_name<const std::map<std::string, int>&>();
+    test_pretty_name<my_namespace::my_template<boost::typeindex::type_index, const boost::typeindex::type_index*> >();
+
+    BOOST_TEST_EQ(boost::typeindex::type_id_with_cvr<const int>().pretty_name(), "int const");
+}
+
+void small_buffer() {
+    char buffer[8];
+    BOOST_TEST_EQ(boost::typeindex::detail::itanium_type_demangler("3fooI3barE", buffer, sizeof(buffer)).demangle(), 8u);
+    BOOST_TEST_EQ(boost::typeindex::detail::itanium_type_demangler("3fooI4barsE", buffer, sizeof(buffer)).demangle(), 0u);
+}
+
+int main() {
+    same_as_cxa_demangle();
+    unsupported_constructs();
+    pretty_names();
+    small_buffer();
+
+    return boost::report_errors();
+}
+
+#else
+
+int main() {
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,113 @@
+//
+// Copyright 2012-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index/concurrent_type_map.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace my_namespace {
+    template <int I> struct my_class {};
+}
+
+using boost::typeindex::type_id;
+using boost::typeindex::concurrent_type_map;
+
+void basic_operations() {
+    concurrent_type_map<std::string> m;
+    BOOST_TEST(m.empty());
+    BOOST_TEST(!m.find(type_id<int>()));
+
+    const auto inserted = m.emplace(type_id<int>(), "int");
+    BOOST_TEST(inserted.second);
+    BOOST_TEST_EQ(inserted.first, "int");
+
+    const auto not_inserted = m.emplace(type_id<const int&>(), "other int");
+    BOOST_TEST(!not_inserted.second);
+    BOOST_TEST_EQ(&not_inserted.first, &inserted.first);
+
+    m.emplace(type_id<std::string>(), 3, 's');
+    BOOST_TEST_EQ(m.size(), 2u);
+    BOOST_TEST_EQ(*m.find(type_id<int>()), "int");
+    BOOST_TEST_EQ(*m.find(type_id<std::string>()), "sss");
+    BOOST_TEST(m.contains(type_id<int>()));
+    BOOST_TEST(!m.contains(type_id<long>()));
+    BOOST_TEST(!m.contains(boost::typeindex::type_id_with_cvr<const int>()));
+
+    const concurrent_type_map<std::string>& cm = m;
+    BOOST_TEST_EQ(cm.find(type_id<int>()), &inserted.first);
+}
+
+template <int I>
+void insert_one(concurrent_type_map<int>& m) {
+    m.emplace(type_id<my_namespace::my_class<I> >(), I);
+}
+
+template <int I>
+bool check_one(const concurrent_type_map<int>& m) {
+    const int* value = m.find(type_id<my_namespace::my_class<I> >());
+    return !value || *value == I;
+}
+
+template <int I>
+bool found_one(const concurrent_type_map<int>& m) {
+    return m.contains(type_id<my_namespace::my_class<I> >());
+}
+
+template <int... I>
+void readers_and_writer_impl() {
+    concurrent_type_map<int> m;
+    std::atomic<bool> done{false};
+    std::atomic<bool> failed{false};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&m, &done, &failed]() {
+            while (!done.load()) {
+                const bool checks[] = { check_one<I>(m)... };
+                for (bool ok : checks) {
+                    if (!ok) {
+                        failed.store(true);
+                    }
+                }
+            }
+        });
+    }
+
+    // Makes the table grow a few times while readers are active
+    const int inserted[] = { (insert_one<I>(m), 0)... };
+    done.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    BOOST_TEST(!failed.load());
+    BOOST_TEST_EQ(m.size(), sizeof(inserted) / sizeof(int));
+    const bool found[] = { found_one<I>(m)... };
+    for (bool f : found) {
+        BOOST_TEST(f);
+    }
+}
+
+void readers_and_writer() {
+    readers_and_writer_impl<
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+        40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59
+    >();
+}
+
+int main() {
+    basic_operations();
+    readers_and_writer();
+
+    return boost::report_errors();
+}
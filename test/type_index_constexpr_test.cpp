@@ -6,6 +6,7 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 
 #include <boost/core/lightweight_test.hpp>
@@ -162,10 +163,75 @@ void not_constexpr_known_names_test() {
     BOOST_TEST_EQ(ctti_type_index::type_id<void>().pretty_name(), "void");
 }
 
+void length_test() {
+    using boost::typeindex::ctti_type_index;
+
+    const ctti_type_index t_int = ctti_type_index::type_id<int>();
+    BOOST_TEST_EQ(t_int.pretty_name(), std::string(t_int.pretty_name().c_str()));
+    BOOST_TEST_EQ(t_int.pretty_name().size(), std::char_traits<char>::length(t_int.pretty_name().c_str()));
+    BOOST_TEST(t_int != ctti_type_index::type_id<unsigned int>());
+    BOOST_TEST(t_int != ctti_type_index::type_id<short>());
+}
+
+template <class T1, class T2>
+void check_order() {
+    using boost::typeindex::ctti_type_index;
+
+    const ctti_type_index t1 = ctti_type_index::type_id<T1>();
+    const ctti_type_index t2 = ctti_type_index::type_id<T2>();
+    BOOST_TEST_EQ(t1 < t2, std::strcmp(t1.raw_name(), t2.raw_name()) < 0);
+    BOOST_TEST_EQ(t2 < t1, std::strcmp(t2.raw_name(), t1.raw_name()) < 0);
+    BOOST_TEST_EQ(t1 == t2, !std::strcmp(t1.raw_name(), t2.raw_name()));
+}
+
+void order_test() {
+    check_order<int, int>();
+    check_order<int, int*>();
+    check_order<int, short>();
+    check_order<char[2], char[3]>();
+    check_order<std::string, std::basic_string<wchar_t> >();
+}
+
+void hash_test() {
+    using boost::typeindex::ctti_type_index;
+
+    const ctti_type_index t_int = ctti_type_index::type_id<int>();
+    BOOST_TEST_EQ(t_int.hash_code(), ctti_type_index::type_id<const int&>().hash_code());
+    BOOST_TEST_NE(t_int.hash_code(), ctti_type_index::type_id<short>().hash_code());
+    BOOST_TEST_NE(t_int.hash_code(), ctti_type_index::type_id_with_cvr<const int>().hash_code());
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+    BOOST_TEST_EQ(
+        t_int.hash_code(),
+        boost::typeindex::detail::constexpr_hash(t_int.raw_name(), std::strlen(t_int.raw_name()))
+    );
+#endif
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && defined(BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED)
+    // Same length, different names
+    BOOST_TEST(ctti_type_index::type_id<char[2]>() != ctti_type_index::type_id<char[3]>());
+    BOOST_TEST(ctti_type_index::type_id<char[2]>() == ctti_type_index::type_id<char[2]>());
+
+    constexpr std::size_t int_hash = ctti_type_index::type_id<int>().hash_code();
+    constexpr std::size_t short_hash = ctti_type_index::type_id<short>().hash_code();
+    static_assert(int_hash != short_hash, "Hashes of different types must differ");
+    BOOST_TEST_EQ(int_hash, t_int.hash_code());
+
+    switch (t_int.hash_code()) {
+    case int_hash: break;
+    case short_hash: BOOST_TEST(false); break;
+    default: BOOST_TEST(false);
+    }
+#endif
+}
+
 int main() {
     strcmp_same();
     search_same();
     constexpr_test();
+    length_test();
+    order_test();
+    hash_test();
 #if !defined(BOOST_NO_CXX14_CONSTEXPR)
     constexpr_known_names_test();
 #else
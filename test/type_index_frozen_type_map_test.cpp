@@ -0,0 +1,163 @@
+//
+// Copyright 2012-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index/frozen_type_map.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <string>
+#include <vector>
+
+namespace my_namespace {
+    template <int I> struct my_class {};
+}
+
+using boost::typeindex::type_id;
+using boost::typeindex::frozen_type_map;
+
+void basic_operations() {
+    const frozen_type_map<std::string> empty;
+    BOOST_TEST(empty.empty());
+    BOOST_TEST(empty.find(type_id<int>()) == empty.end());
+    BOOST_TEST(!empty.contains(type_id<int>()));
+
+    frozen_type_map<std::string> m = {
+        {type_id<int>(), "int"},
+        {type_id<short>(), "short"},
+        {type_id<std::string>(), "string"},
+    };
+
+    BOOST_TEST_EQ(m.size(), 3u);
+    BOOST_TEST_EQ(m.at(type_id<int>()), "int");
+    BOOST_TEST_EQ(m.at(type_id<const short&>()), "short");
+    BOOST_TEST_EQ(m.find(type_id<std::string>())->second, "string");
+    BOOST_TEST_EQ(m.count(type_id<int>()), 1u);
+    BOOST_TEST(!m.contains(type_id<long>()));
+    BOOST_TEST(!m.contains(boost::typeindex::type_id_with_cvr<const int>()));
+    BOOST_TEST_THROWS(m.at(type_id<long>()), std::out_of_range);
+
+    m.find(type_id<int>())->second = "integer";
+    BOOST_TEST_EQ(m.at(type_id<int>()), "integer");
+
+    std::size_t count = 0;
+    for (const auto& v : m) {
+        BOOST_TEST(m.find(v.first)->second == v.second);
+        ++count;
+    }
+    BOOST_TEST_EQ(count, 3u);
+
+    BOOST_TEST_THROWS(
+        (frozen_type_map<int>{{type_id<int>(), 1}, {type_id<short>(), 2}, {type_id<const int>(), 3}}),
+        std::invalid_argument
+    );
+}
+
+template <int I>
+void check_one(const frozen_type_map<int>& m) {
+    const auto it = m.find(type_id<my_namespace::my_class<I> >());
+    BOOST_TEST(it != m.end() && it->second == I);
+}
+
+template <int... I>
+void many_types_impl() {
+    std::vector<std::pair<boost::typeindex::type_index, int> > values = {
+        {type_id<my_namespace::my_class<I> >(), I}...
+    };
+    const frozen_type_map<int> m(values.begin(), values.end());
+    BOOST_TEST_EQ(m.size(), values.size());
+
+    const int checked[] = { (check_one<I>(m), 0)... };
+    (void)checked;
+    BOOST_TEST(m.find(type_id<my_namespace::my_class<-1> >()) == m.end());
+    BOOST_TEST(m.find(type_id<int>()) == m.end());
+}
+
+void many_types() {
+    many_types_impl<0>();
+    many_types_impl<0, 1>();
+    many_types_impl<0, 1, 2, 3, 4, 5, 6, 7, 8>();
+    many_types_impl<
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+        40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+        60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79
+    >();
+}
+
+// Hashes that differ only in the high bits, like the hashes of aligned pointers
+void low_entropy_hashes() {
+    using perfect_hash = boost::typeindex::detail::frozen_type_map_hash;
+    const unsigned shift = sizeof(std::size_t) * 4;
+
+    for (std::size_t size : {1u, 2u, 100u, 5000u}) {
+        std::vector<std::size_t> hashes(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            hashes[i] = (i + 1) << shift;
+        }
+
+        std::vector<std::size_t> slots;
+        const std::vector<std::size_t> seeds = perfect_hash::build(hashes, slots);
+        BOOST_TEST_LE(seeds.size(), size * 2);
+
+        std::vector<bool> taken(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            const std::size_t slot = perfect_hash::slot(
+                hashes[i], seeds[perfect_hash::bucket_of(hashes[i], seeds.size())], size
+            );
+            BOOST_TEST_EQ(slot, slots[i]);
+            BOOST_TEST(!taken[slot]);
+            taken[slot] = true;
+        }
+    }
+}
+
+// Different keys with equal hashes, as with 32 bit std::size_t or user defined hash_code()
+void equal_hashes() {
+    using perfect_hash = boost::typeindex::detail::frozen_type_map_hash;
+
+    const std::vector<std::size_t> hashes = {7, 3, 7, 9, 7, 3};
+    std::vector<std::size_t> seeds;
+    std::vector<std::size_t> order;
+    const std::size_t hashed_size = perfect_hash::layout(hashes, [](std::size_t lhs, std::size_t rhs) {
+        return lhs == rhs;
+    }, seeds, order);
+
+    BOOST_TEST_EQ(hashed_size, 3u);
+    BOOST_TEST_EQ(order.size(), hashes.size());
+
+    std::vector<bool> seen(hashes.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        BOOST_TEST(!seen[order[i]]);
+        seen[order[i]] = true;
+    }
+
+    // Each distinct hash is found in its slot, the rest are in the overflow area
+    for (std::size_t i = 0; i < hashed_size; ++i) {
+        const std::size_t hash = hashes[order[i]];
+        BOOST_TEST_EQ(perfect_hash::slot(hash, seeds[perfect_hash::bucket_of(hash, seeds.size())], hashed_size), i);
+    }
+    for (std::size_t i = hashed_size; i < order.size(); ++i) {
+        BOOST_TEST(hashes[order[i]] == 7 || hashes[order[i]] == 3);
+    }
+
+    // Equal keys are still rejected
+    BOOST_TEST_THROWS(
+        perfect_hash::layout(hashes, [&hashes](std::size_t lhs, std::size_t rhs) {
+            return hashes[lhs] == hashes[rhs];
+        }, seeds, order),
+        std::invalid_argument
+    );
+}
+
+int main() {
+    basic_operations();
+    many_types();
+    low_entropy_hashes();
+    equal_hashes();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,109 @@
+//
+// Copyright 2012-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index/type_ordinal.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace my_namespace {
+    template <int I> struct my_class {};
+}
+
+void dense_ordinals() {
+    using boost::typeindex::type_id;
+    using boost::typeindex::type_ordinal;
+
+    const std::size_t count_before = boost::typeindex::type_ordinals_count();
+    const std::size_t i = type_ordinal(type_id<int>());
+    const std::size_t s = type_ordinal(type_id<std::string>());
+    const std::size_t c = type_ordinal(type_id<my_namespace::my_class<0> >());
+
+    BOOST_TEST_EQ(i, count_before);
+    BOOST_TEST_EQ(s, count_before + 1);
+    BOOST_TEST_EQ(c, count_before + 2);
+    BOOST_TEST_EQ(boost::typeindex::type_ordinals_count(), count_before + 3);
+
+    BOOST_TEST_EQ(type_ordinal(type_id<int>()), i);
+    BOOST_TEST_EQ(type_ordinal(type_id<const int&>()), i);
+    BOOST_TEST_EQ(type_ordinal<int>(), i);
+    BOOST_TEST_EQ(type_ordinal<const int>(), i);
+    BOOST_TEST_EQ(type_ordinal<std::string>(), s);
+    BOOST_TEST_EQ(type_ordinal<my_namespace::my_class<0> >(), c);
+
+    BOOST_TEST_NE(type_ordinal(boost::typeindex::type_id_with_cvr<const int>()), i);
+    BOOST_TEST_EQ(boost::typeindex::type_ordinals_count(), count_before + 4);
+}
+
+template <int... I>
+void register_many() {
+    const std::size_t ordinals[] = { boost::typeindex::type_ordinal<my_namespace::my_class<I> >()... };
+    for (std::size_t ordinal : ordinals) {
+        BOOST_TEST_LT(ordinal, boost::typeindex::type_ordinals_count());
+    }
+}
+
+// Makes the internal table grow a few times
+void many_ordinals() {
+    register_many<
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+        21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40
+    >();
+
+    BOOST_TEST_EQ(
+        boost::typeindex::type_ordinal<my_namespace::my_class<40> >(),
+        boost::typeindex::type_ordinal(boost::typeindex::type_id<my_namespace::my_class<40> >())
+    );
+    BOOST_TEST_EQ(
+        boost::typeindex::type_ordinal<my_namespace::my_class<39> >() + 1,
+        boost::typeindex::type_ordinal<my_namespace::my_class<40> >()
+    );
+}
+
+template <int I>
+void concurrent_ordinals_impl(std::vector<std::size_t>& results) {
+    results.push_back(boost::typeindex::type_ordinal(boost::typeindex::type_id<my_namespace::my_class<I> >()));
+}
+
+template <int... I>
+void concurrent_ordinals_all(std::vector<std::size_t>& results) {
+    const int dummy[] = { (concurrent_ordinals_impl<I>(results), 0)... };
+    (void)dummy;
+}
+
+void concurrent_ordinals() {
+    constexpr std::size_t threads_count = 4;
+    std::vector<std::vector<std::size_t> > results(threads_count);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < threads_count; ++i) {
+        threads.emplace_back([&results, i]() {
+            concurrent_ordinals_all<
+                100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+                110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+                120, 121, 122, 123, 124, 125, 126, 127, 128, 129
+            >(results[i]);
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    for (std::size_t i = 1; i < threads_count; ++i) {
+        BOOST_TEST(results[i] == results[0]);
+    }
+}
+
+int main() {
+    dense_ordinals();
+    many_ordinals();
+    concurrent_ordinals();
+
+    return boost::report_errors();
+}
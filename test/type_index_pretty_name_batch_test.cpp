@@ -0,0 +1,115 @@
+//
+// Copyright 2012-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index/pretty_name_batch.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace my_namespace {
+    struct my_class {};
+
+    template <class T>
+    struct my_template {};
+}
+
+std::vector<boost::typeindex::stl_type_index> types() {
+    using namespace boost::typeindex;
+    std::vector<stl_type_index> result;
+    result.push_back(stl_type_index::type_id<int>());
+    result.push_back(stl_type_index::type_id<my_namespace::my_class>());
+    result.push_back(stl_type_index::type_id_with_cvr<const my_namespace::my_class&>());
+    result.push_back(stl_type_index::type_id<my_namespace::my_template<my_namespace::my_class> >());
+    result.push_back(stl_type_index::type_id_with_cvr<const volatile int>());
+    result.push_back(stl_type_index::type_id<std::map<std::string, std::vector<int> > >());
+    return result;
+}
+
+void check_batch(const std::vector<const char*>& raw_names, const std::vector<std::string>& expected,
+                 std::size_t threads)
+{
+    const boost::typeindex::pretty_name_batch batch(raw_names.data(), raw_names.size(), threads);
+    BOOST_TEST_EQ(batch.size(), expected.size());
+    BOOST_TEST_EQ(batch.offsets().size(), expected.size());
+    for (std::size_t i = 0; i < batch.size() && i < expected.size(); ++i) {
+        BOOST_TEST_EQ(batch[i], expected[i]);
+        BOOST_TEST_EQ(batch.length(i), expected[i].size());
+        BOOST_TEST_EQ(batch.buffer().data() + batch.offsets()[i], batch[i]);
+    }
+}
+
+void same_as_pretty_name() {
+    std::vector<const char*> raw_names;
+    std::vector<std::string> expected;
+    for (const boost::typeindex::stl_type_index& t : types()) {
+        raw_names.push_back(t.name());
+        expected.push_back(t.pretty_name());
+    }
+
+    for (std::size_t threads = 0; threads < 10; ++threads) {
+        check_batch(raw_names, expected, threads);
+    }
+}
+
+void deduplication() {
+    std::vector<const char*> raw_names;
+    std::vector<std::string> expected;
+    std::vector<std::string> copies;
+    const std::vector<boost::typeindex::stl_type_index> all = types();
+    copies.reserve(all.size());
+    for (const boost::typeindex::stl_type_index& t : all) {
+        copies.push_back(t.name());
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        const std::size_t index = (i * 7) % all.size();
+        // Identical names at different addresses, as if they were received from another process
+        raw_names.push_back(i % 2 ? all[index].name() : copies[index].c_str());
+        expected.push_back(all[index].pretty_name());
+    }
+
+    for (std::size_t threads = 1; threads < 4; ++threads) {
+        check_batch(raw_names, expected, threads);
+
+        const boost::typeindex::pretty_name_batch batch(raw_names.data(), raw_names.size(), threads);
+        std::size_t expected_size = 0;
+        for (const boost::typeindex::stl_type_index& t : all) {
+            expected_size += t.pretty_name().size() + 1;
+        }
+        BOOST_TEST_EQ(batch.buffer().size(), expected_size);
+        BOOST_TEST_EQ(batch.offsets()[0], batch.offsets()[all.size()]);
+    }
+}
+
+void edge_cases() {
+    const boost::typeindex::pretty_name_batch empty(nullptr, 0, 4);
+    BOOST_TEST_EQ(empty.size(), 0u);
+    BOOST_TEST(empty.buffer().empty());
+
+    const boost::typeindex::pretty_name_batch default_constructed;
+    BOOST_TEST_EQ(default_constructed.size(), 0u);
+
+#if defined(__GNUC__) && !defined(_MSC_VER)
+    // Not a mangled name, copied as is
+    const char* raw_names[] = {"?not a name?", typeid(int).name()};
+    const boost::typeindex::pretty_name_batch batch(raw_names, 2);
+    BOOST_TEST_EQ(batch[0], std::string("?not a name?"));
+    BOOST_TEST_EQ(batch[1], std::string("int"));
+#endif
+}
+
+int main() {
+    same_as_pretty_name();
+    deduplication();
+    edge_cases();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,162 @@
+//
+// Copyright 2012-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/pretty_name_cstr.hpp>
+
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <string>
+
+// Counts the allocations of the whole program. All the replaced forms of
+// operator new and operator delete go through the same pair of functions,
+// so the memory is always allocated with std::malloc and freed with std::free.
+std::size_t allocations = 0;
+
+BOOST_NOINLINE void* counted_malloc(std::size_t size) noexcept {
+    ++allocations;
+    return std::malloc(size ? size : 1);
+}
+
+BOOST_NOINLINE void counted_free(void* p) noexcept {
+    std::free(p);
+}
+
+void* operator new(std::size_t size) {
+    if (void* p = counted_malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* p = counted_malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_malloc(size);
+}
+
+void operator delete(void* p) noexcept {
+    counted_free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    counted_free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    counted_free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    counted_free(p);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void* p, std::size_t) noexcept {
+    counted_free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    counted_free(p);
+}
+#endif
+
+namespace my_namespace {
+    template <class T>
+    class my_template {};
+}
+
+template <class T>
+void test_buffer() {
+    using namespace boost::typeindex;
+    const type_index ti = type_id_with_cvr<T>();
+    const std::string expected = ti.pretty_name();
+
+    char buffer[256];
+    BOOST_TEST_EQ(pretty_name_to(ti, buffer, sizeof(buffer)), expected.size());  // warming up the cache
+    BOOST_TEST_EQ(std::string(buffer), expected);
+
+    const std::size_t before = allocations;
+    for (int i = 0; i < 100; ++i) {
+        buffer[0] = '\0';
+        pretty_name_to(ti, buffer, sizeof(buffer));
+    }
+    BOOST_TEST_EQ(allocations, before);
+    BOOST_TEST_EQ(std::string(buffer), expected);
+}
+
+template <class T>
+void test_output_iterator() {
+    using namespace boost::typeindex;
+    const type_index ti = type_id_with_cvr<T>();
+    const std::string expected = ti.pretty_name();
+
+    std::string result;
+    result.reserve(256);
+    pretty_name_to(ti, std::back_inserter(result));  // warming up the cache
+    BOOST_TEST_EQ(result, expected);
+
+    const std::size_t before = allocations;
+    for (int i = 0; i < 100; ++i) {
+        result.clear();
+        pretty_name_to(ti, std::back_inserter(result));
+    }
+    BOOST_TEST_EQ(allocations, before);
+    BOOST_TEST_EQ(result, expected);
+
+    char buffer[256];
+    char* const end = pretty_name_to(ti, buffer);
+    BOOST_TEST_EQ(std::string(buffer, end), expected);
+}
+
+void no_allocations_on_repeated_calls() {
+    test_buffer<int>();
+    test_buffer<const int>();
+    test_buffer<my_namespace::my_template<double> >();
+
+    test_output_iterator<int>();
+    test_output_iterator<const volatile int&>();
+    test_output_iterator<my_namespace::my_template<char> >();
+}
+
+void truncation() {
+    using namespace boost::typeindex;
+    const type_index ti = type_id<int>();
+
+    char buffer[8] = "xxxxxxx";
+    BOOST_TEST_EQ(pretty_name_to(ti, buffer, 0), 3u);
+    BOOST_TEST_EQ(std::string(buffer), "xxxxxxx");
+
+    BOOST_TEST_EQ(pretty_name_to(ti, buffer, 1), 3u);
+    BOOST_TEST_EQ(std::string(buffer), "");
+
+    BOOST_TEST_EQ(pretty_name_to(ti, buffer, 3), 3u);
+    BOOST_TEST_EQ(std::string(buffer), "in");
+
+    BOOST_TEST_EQ(pretty_name_to(ti, buffer, 4), 3u);
+    BOOST_TEST_EQ(std::string(buffer), "int");
+}
+
+int main() {
+    no_allocations_on_repeated_calls();
+    truncation();
+
+    return boost::report_errors();
+}
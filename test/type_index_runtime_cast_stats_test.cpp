@@ -0,0 +1,141 @@
+//
+// Copyright 2012-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Must be compiled with BOOST_TYPE_INDEX_RUNTIME_CAST_STATS defined
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_STATS
+#error "This test must be compiled with BOOST_TYPE_INDEX_RUNTIME_CAST_STATS defined"
+#endif
+
+#include <boost/type_index/runtime_cast.hpp>
+#include <boost/type_index/runtime_cast/runtime_cast_stats.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+struct base {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~base() {}
+};
+
+struct other {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~other() {}
+};
+
+struct derived : base, other {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(base, other)
+};
+
+struct unrelated {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~unrelated() {}
+};
+
+using boost::typeindex::runtime_cast_stats_entry;
+using boost::typeindex::type_id;
+
+const runtime_cast_stats_entry* find_entry(const std::vector<runtime_cast_stats_entry>& stats,
+        const std::string& source, const std::string& target, const std::string& dynamic_type)
+{
+    for (const auto& e : stats) {
+        if (e.source == source && e.target == target && e.dynamic_type == dynamic_type) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+void counters() {
+    boost::typeindex::runtime_cast_stats_reset();
+    BOOST_TEST(boost::typeindex::runtime_cast_stats_snapshot().empty());
+
+    derived d;
+    base b;
+    base* from_derived = &d;
+    base* from_base = &b;
+    for (int i = 0; i < 3; ++i) {
+        BOOST_TEST(boost::typeindex::runtime_cast<other*>(from_derived));
+        BOOST_TEST(!boost::typeindex::runtime_cast<unrelated*>(from_derived));
+    }
+    BOOST_TEST(!boost::typeindex::runtime_cast<other*>(from_base));
+
+    // Static upcasts do not search through the bases and are not counted
+    BOOST_TEST(boost::typeindex::runtime_pointer_cast<base>(&d));
+
+    const std::vector<runtime_cast_stats_entry> stats = boost::typeindex::runtime_cast_stats_snapshot();
+    BOOST_TEST_EQ(stats.size(), 3u);
+
+    const std::string base_name = type_id<base>().pretty_name();
+    const std::string other_name = type_id<other>().pretty_name();
+    const std::string derived_name = type_id<derived>().pretty_name();
+    const std::string unrelated_name = type_id<unrelated>().pretty_name();
+
+    const runtime_cast_stats_entry* sideways = find_entry(stats, base_name, other_name, derived_name);
+    BOOST_TEST(sideways);
+    if (sideways) {
+        BOOST_TEST_EQ(sideways->calls, 3u);
+        BOOST_TEST_EQ(sideways->successes, 3u);
+        BOOST_TEST_EQ(sideways->failures, 0u);
+        BOOST_TEST(sideways->visited >= 3u);
+    }
+
+    const runtime_cast_stats_entry* failed = find_entry(stats, base_name, unrelated_name, derived_name);
+    BOOST_TEST(failed);
+    if (failed) {
+        BOOST_TEST_EQ(failed->calls, 3u);
+        BOOST_TEST_EQ(failed->successes, 0u);
+        BOOST_TEST_EQ(failed->failures, 3u);
+    }
+
+    const runtime_cast_stats_entry* from_base_entry = find_entry(stats, base_name, other_name, base_name);
+    BOOST_TEST(from_base_entry);
+    if (from_base_entry) {
+        BOOST_TEST_EQ(from_base_entry->calls, 1u);
+        BOOST_TEST_EQ(from_base_entry->failures, 1u);
+    }
+
+    // Sorted by the count of calls
+    BOOST_TEST_EQ(stats.back().calls, 1u);
+}
+
+void threads() {
+    boost::typeindex::runtime_cast_stats_reset();
+
+    derived d;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&d]() {
+            const other* o = &d;
+            for (int i = 0; i < 1000; ++i) {
+                BOOST_TEST(boost::typeindex::runtime_cast<const derived*>(o));
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    // Counters of the finished threads are kept
+    const std::vector<runtime_cast_stats_entry> stats = boost::typeindex::runtime_cast_stats_snapshot();
+    BOOST_TEST_EQ(stats.size(), 1u);
+    if (!stats.empty()) {
+        BOOST_TEST_EQ(stats.front().source, type_id<other>().pretty_name());
+        BOOST_TEST_EQ(stats.front().target, type_id<derived>().pretty_name());
+        BOOST_TEST_EQ(stats.front().calls, 4000u);
+        BOOST_TEST_EQ(stats.front().successes, 4000u);
+    }
+}
+
+int main() {
+    counters();
+    threads();
+
+    return boost::report_errors();
+}
@@ -15,6 +15,10 @@
 #include <boost/type_index/runtime_cast.hpp>
 #include <boost/type_index/runtime_cast/boost_shared_ptr_cast.hpp>
 
+#include <iterator>
+#include <utility>
+#include <vector>
+
 #if !defined(BOOST_NO_CXX11_SMART_PTR)
 #  include <boost/type_index/runtime_cast/std_shared_ptr_cast.hpp>
 #endif
@@ -98,6 +102,16 @@ struct level2 : level1_a, level1_b {
     IMPLEMENT_CLASS(level2)
 };
 
+struct final_derived final : baseV1 {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(baseV1)
+    IMPLEMENT_CLASS(final_derived)
+};
+
+struct final_multiple_derived final : base1, base2 {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(base1, base2)
+    IMPLEMENT_CLASS(final_multiple_derived)
+};
+
 struct reg_base {
     BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS()
 };
@@ -217,6 +231,30 @@ void const_pointer_interface()
     BOOST_TEST_EQ(runtime_pointer_cast<unrelated>(b), (unrelated*)NULL);
 }
 
+void try_reference_interface()
+{
+#if !defined(BOOST_NO_CXX17_HDR_OPTIONAL)
+    using namespace boost::typeindex;
+    multiple_virtual_derived d;
+    base& b = d;
+    std::optional<std::reference_wrapper<baseV2> > v2 = try_runtime_reference_cast<baseV2>(b);
+    BOOST_TEST(v2.has_value());
+    BOOST_TEST_EQ(&v2->get(), static_cast<baseV2*>(&d));
+    BOOST_TEST_EQ(v2->get().name, "baseV2");
+    BOOST_TEST(!try_runtime_reference_cast<unrelated>(b));
+
+    const base& cb = d;
+    std::optional<std::reference_wrapper<const multiple_virtual_derived> > cd
+        = try_runtime_reference_cast<multiple_virtual_derived>(cb);
+    BOOST_TEST(cd.has_value());
+    BOOST_TEST_EQ(&cd->get(), &d);
+    BOOST_TEST(!try_runtime_reference_cast<single_derived>(cb));
+
+    // Upcasts do not require a search
+    BOOST_TEST_EQ(&try_runtime_reference_cast<base>(d)->get(), &b);
+#endif
+}
+
 void const_reference_interface()
 {
     using namespace boost::typeindex;
@@ -256,6 +294,16 @@ void boost_shared_ptr()
     boost::shared_ptr<single_derived> d2 = runtime_pointer_cast<single_derived>(b);
     BOOST_TEST_NE(d2, boost::shared_ptr<single_derived>());
     BOOST_TEST_EQ(d2->name, "single_derived");
+
+    // Moved from source is left untouched if the cast fails
+    BOOST_TEST_EQ(runtime_pointer_cast<unrelated>(std::move(b)), boost::shared_ptr<unrelated>());
+    BOOST_TEST_EQ(b, d);
+    BOOST_TEST_EQ(d.use_count(), 3);
+
+    boost::shared_ptr<single_derived> d3 = runtime_pointer_cast<single_derived>(std::move(b));
+    BOOST_TEST_EQ(d3, d);
+    BOOST_TEST_EQ(b, boost::shared_ptr<base>());
+    BOOST_TEST_EQ(d.use_count(), 3);
 }
 
 void std_shared_ptr()
@@ -267,6 +315,16 @@ void std_shared_ptr()
     std::shared_ptr<single_derived> d2 = runtime_pointer_cast<single_derived>(b);
     BOOST_TEST_NE(d2, std::shared_ptr<single_derived>());
     BOOST_TEST_EQ(d2->name, "single_derived");
+
+    // Moved from source is left untouched if the cast fails
+    BOOST_TEST(!runtime_pointer_cast<unrelated>(std::move(b)));
+    BOOST_TEST_EQ(b, d);
+    BOOST_TEST_EQ(d.use_count(), 3);
+
+    std::shared_ptr<single_derived> d3 = runtime_pointer_cast<single_derived>(std::move(b));
+    BOOST_TEST_EQ(d3, d);
+    BOOST_TEST(!b);
+    BOOST_TEST_EQ(d.use_count(), 3);
 #endif
 }
 
@@ -280,18 +338,313 @@ void register_runtime_class()
     BOOST_TEST_EQ(type_id_runtime(*prd), type_id<reg_derived>());
 }
 
+template <int Depth, int Index>
+struct tree_node;
+
+template <int Index>
+struct tree_node<0, Index> {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    virtual ~tree_node() {}
+    int index = Index;
+};
+
+template <int Depth, int Index>
+struct tree_node : tree_node<Depth - 1, 0>, tree_node<Depth - 1, 1>, tree_node<Depth - 1, 2> {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(tree_node<Depth - 1, 0>, tree_node<Depth - 1, 1>, tree_node<Depth - 1, 2>)
+    int index = Index;
+};
+
+void deep_hierarchy()
+{
+    using namespace boost::typeindex;
+    typedef tree_node<3, 0> root_t;
+    typedef tree_node<2, 0> left_t;
+    typedef tree_node<2, 2> right_t;
+    typedef tree_node<1, 0> left_left_t;
+    typedef tree_node<1, 1> left_middle_t;
+    typedef tree_node<1, 2> right_right_t;
+    typedef tree_node<0, 0> first_leaf_t;
+    typedef tree_node<0, 2> last_leaf_t;
+    typedef tree_node<3, 1> other_root_t;
+
+    root_t root;
+    left_t* left = &root;
+    first_leaf_t* first_leaf = static_cast<left_left_t*>(left);
+    last_leaf_t* last_leaf = static_cast<right_right_t*>(static_cast<right_t*>(&root));
+
+    BOOST_TEST_EQ(runtime_pointer_cast<root_t>(first_leaf), &root);
+    BOOST_TEST_EQ(runtime_pointer_cast<root_t>(last_leaf), &root);
+
+    // First match in the depth first order, as for the direct walk through the bases
+    BOOST_TEST_EQ(runtime_pointer_cast<last_leaf_t>(first_leaf), static_cast<last_leaf_t*>(static_cast<left_left_t*>(left)));
+    BOOST_TEST_EQ(runtime_pointer_cast<left_middle_t>(last_leaf), static_cast<left_middle_t*>(left));
+    BOOST_TEST_EQ(runtime_pointer_cast<right_t>(first_leaf), static_cast<right_t*>(&root));
+    BOOST_TEST_EQ(runtime_pointer_cast<right_t>(first_leaf)->index, 2);
+
+    BOOST_TEST_EQ(runtime_pointer_cast<other_root_t>(first_leaf), (other_root_t*)NULL);
+    BOOST_TEST_EQ(runtime_pointer_cast<unrelated>(last_leaf), (unrelated*)NULL);
+}
+
+void cached_casts()
+{
+    using namespace boost::typeindex;
+    static runtime_cast_cache<base> base_cache;
+    static runtime_cast_cache<level1_b> level1_b_cache;
+    static runtime_cast_cache<multiple_virtual_derived> derived_cache;
+    static runtime_cast_cache<unrelated> unrelated_cache;
+
+    multiple_virtual_derived d1, d2;
+    baseV1 v1;
+    for (int i = 0; i < 2; ++i) {
+        base* b = &d1;
+        BOOST_TEST_EQ(runtime_cast<multiple_virtual_derived*>(b, derived_cache), &d1);
+        b = &d2;
+        BOOST_TEST_EQ(runtime_pointer_cast<multiple_virtual_derived>(b, derived_cache), &d2);
+        BOOST_TEST_EQ(runtime_pointer_cast<multiple_virtual_derived>(b, derived_cache)->name, "multiple_virtual_derived");
+        b = &v1;
+        BOOST_TEST_EQ(runtime_pointer_cast<multiple_virtual_derived>(b, derived_cache), (multiple_virtual_derived*)NULL);
+        BOOST_TEST_EQ(runtime_pointer_cast<multiple_virtual_derived>(b, derived_cache), (multiple_virtual_derived*)NULL);
+
+        BOOST_TEST_EQ(runtime_pointer_cast<base>(static_cast<baseV2*>(&d1), base_cache), static_cast<base*>(&d1));
+        BOOST_TEST_EQ(runtime_pointer_cast<unrelated>(static_cast<baseV2*>(&d1), unrelated_cache), (unrelated*)NULL);
+        BOOST_TEST_EQ(runtime_pointer_cast<unrelated>(static_cast<baseV2*>(&d1), unrelated_cache), (unrelated*)NULL);
+    }
+
+    // Same dynamic type, but different subobjects
+    level2 inst;
+    base* from_a = static_cast<level1_a*>(&inst);
+    base* from_b = static_cast<level1_b*>(&inst);
+    for (int i = 0; i < 2; ++i) {
+        BOOST_TEST_EQ(runtime_cast<level1_b*>(from_a, level1_b_cache), static_cast<level1_b*>(&inst));
+        BOOST_TEST_EQ(runtime_cast<level1_b*>(from_b, level1_b_cache), static_cast<level1_b*>(&inst));
+        BOOST_TEST_EQ(runtime_cast<level1_b const*>(static_cast<base const*>(from_a), level1_b_cache)->name, "level1_b");
+    }
+}
+
+void runtime_visit_dispatch()
+{
+    using namespace boost::typeindex;
+    multiple_virtual_derived mvd;
+    level2 l2;
+    single_derived sd;
+    base b;
+
+    for (int i = 0; i < 2; ++i) {
+        // First matching target wins, the last handler is called if nothing matches
+        base* sources[] = {&sd, static_cast<baseV1*>(&mvd), &b, static_cast<level1_b*>(&l2)};
+        const char* expected[] = {"single_derived", "baseV2", "none", "level1_a"};
+        for (int j = 0; j < 4; ++j) {
+            const std::string name = runtime_visit<single_derived, baseV2, level1_a>(sources[j],
+                [](single_derived& d) { return d.name; },
+                [](baseV2& v) { return v.name; },
+                [](level1_a& l) { return l.name; },
+                [](base&) { return std::string("none"); }
+            );
+            BOOST_TEST_EQ(name, expected[j]);
+        }
+
+        // Handlers receive the subobject of the target type
+        base* from_b = static_cast<level1_b*>(&l2);
+        const bool complete = runtime_visit<level2>(from_b,
+            [&l2](level2& l) { return &l == &l2; },
+            [](base&) { return false; }
+        );
+        BOOST_TEST(complete);
+        const bool sibling = runtime_visit<baseV1, baseV2>(static_cast<base*>(&mvd),
+            [&mvd](baseV1& v) { return &v == static_cast<baseV1*>(&mvd); },
+            [](baseV2&) { return false; },
+            [](base&) { return false; }
+        );
+        BOOST_TEST(sibling);
+
+        // Bases of the static type match without a search and give the subobject of that static type,
+        // even if the dynamic type has several subobjects of the target type
+        level1_a* from_a = &l2;
+        level1_b* from_b_static = &l2;
+        const bool base_of_a = runtime_visit<unrelated, base, level2>(from_a,
+            [](unrelated&) { return false; },
+            [from_a](base& x) { return &x == static_cast<base*>(from_a); },
+            [](level2&) { return false; },
+            [](level1_a&) { return false; }
+        );
+        BOOST_TEST(base_of_a);
+        const bool base_of_b = runtime_visit<unrelated, base, level2>(from_b_static,
+            [](unrelated&) { return false; },
+            [from_b_static](base& x) { return &x == static_cast<base*>(from_b_static); },
+            [](level2&) { return false; },
+            [](level1_b&) { return false; }
+        );
+        BOOST_TEST(base_of_b);
+        const bool dynamic_first = runtime_visit<level2, level1_b>(from_b_static,
+            [&l2](level2& l) { return &l == &l2; },
+            [](level1_b&) { return false; },
+            [](level1_b&) { return false; }
+        );
+        BOOST_TEST(dynamic_first);
+
+        // Const sources give const references, handlers could return nothing
+        const base* cb = &b;
+        int called = 0;
+        runtime_visit<single_derived>(cb,
+            [&called](const single_derived&) { called = 1; },
+            [&called](const base& x) { called = (x.name == "base" ? 2 : 3); }
+        );
+        BOOST_TEST_EQ(called, 2);
+    }
+}
+
+void runtime_is_queries()
+{
+    using namespace boost::typeindex;
+    multiple_virtual_derived mvd;
+    level2 l2;
+    single_derived sd;
+    base b;
+
+    base* from_v2 = static_cast<baseV2*>(&mvd);
+    BOOST_TEST(runtime_is<multiple_virtual_derived>(from_v2));
+    BOOST_TEST(runtime_is<baseV1>(from_v2));
+    BOOST_TEST(runtime_is<const baseV2>(from_v2));
+    BOOST_TEST(runtime_is<base>(*from_v2));
+    BOOST_TEST(!runtime_is<unrelated>(from_v2));
+    BOOST_TEST(!runtime_is<level1_a>(*from_v2));
+
+    const base* from_b = static_cast<level1_b*>(&l2);
+    BOOST_TEST(runtime_is<level1_a>(from_b));
+    BOOST_TEST(runtime_is<level2>(*from_b));
+
+    BOOST_TEST(runtime_is<base>(&sd));
+    BOOST_TEST(runtime_is<single_derived>(static_cast<base*>(&sd)));
+    BOOST_TEST(!runtime_is<single_derived>(&b));
+    BOOST_TEST(!runtime_is<base>(static_cast<base*>(nullptr)));
+
+    reg_derived rd;
+    BOOST_TEST(runtime_is<reg_derived>(static_cast<reg_base&>(rd)));
+}
+
+void final_target()
+{
+    using namespace boost::typeindex;
+    final_derived fd;
+    final_multiple_derived fmd;
+    multiple_virtual_derived mvd;
+    multiple_derived md;
+
+    base* b = &fd;
+    BOOST_TEST_EQ(runtime_cast<final_derived*>(b), &fd);
+    BOOST_TEST_EQ(runtime_pointer_cast<const final_derived>(b)->name, "final_derived");
+    BOOST_TEST_EQ(&runtime_cast<final_derived&>(*b), &fd);
+    BOOST_TEST(runtime_is<final_derived>(b));
+
+    b = static_cast<baseV1*>(&mvd);
+    BOOST_TEST_EQ(runtime_cast<final_derived*>(b), (final_derived*)NULL);
+    BOOST_TEST(!runtime_is<final_derived>(b));
+
+    base2* b2 = &fmd;
+    BOOST_TEST_EQ(runtime_cast<final_multiple_derived*>(b2), &fmd);
+    BOOST_TEST_EQ(runtime_pointer_cast<final_multiple_derived>(b2)->name, "final_multiple_derived");
+    b2 = &md;
+    BOOST_TEST_EQ(runtime_cast<final_multiple_derived*>(b2), (final_multiple_derived*)NULL);
+
+    static runtime_cast_cache<final_multiple_derived> cache;
+    BOOST_TEST_EQ(runtime_pointer_cast<final_multiple_derived>(static_cast<base1*>(&fmd), cache), &fmd);
+    BOOST_TEST_EQ(runtime_pointer_cast<final_multiple_derived>(static_cast<base1*>(&md), cache), (final_multiple_derived*)NULL);
+}
+
+void filter_range()
+{
+    using namespace boost::typeindex;
+    typedef tree_node<0, 0> leaf00_t;
+    typedef tree_node<0, 2> leaf02_t;
+    typedef tree_node<1, 1> node11_t;
+    typedef tree_node<2, 0> node20_t;
+    typedef tree_node<3, 0> root_t;
+
+    single_derived sd[20];
+    multiple_virtual_derived mvd[20];
+    level2 l2[20];
+    base b[20];
+
+    std::vector<base*> objects;
+    for (std::size_t i = 0; i < 20; ++i) {
+        objects.push_back(&sd[i]);
+        objects.push_back(static_cast<baseV2*>(&mvd[i]));
+        objects.push_back(static_cast<level1_b*>(&l2[i]));
+        objects.push_back(nullptr);
+        objects.push_back(&b[i]);
+    }
+
+    std::vector<baseV1*> v1;
+    runtime_cast_filter<baseV1>(objects.begin(), objects.end(), std::back_inserter(v1));
+    BOOST_TEST_EQ(v1.size(), 20u);
+    for (std::size_t i = 0; i < v1.size(); ++i) {
+        BOOST_TEST_EQ(v1[i], static_cast<baseV1*>(&mvd[i]));
+    }
+
+    std::vector<const level1_a*> la;
+    const std::vector<const base*> const_objects(objects.begin(), objects.end());
+    runtime_cast_filter<level1_a>(const_objects.begin(), const_objects.end(), std::back_inserter(la));
+    BOOST_TEST_EQ(la.size(), 20u);
+    for (std::size_t i = 0; i < la.size(); ++i) {
+        BOOST_TEST_EQ(la[i], static_cast<const level1_a*>(&l2[i]));
+        BOOST_TEST_EQ(la[i]->name, "level1_a");
+    }
+
+    base* found[100];
+    BOOST_TEST_EQ(runtime_cast_filter<base>(objects.begin(), objects.end(), found) - found, 80);
+    unrelated* none[100];
+    BOOST_TEST_EQ(runtime_cast_filter<unrelated>(objects.begin(), objects.end(), none) - none, 0);
+
+    // Sideways casts in the objects of different dynamic types, first matching subobject is returned
+    root_t root;
+    tree_node<2, 1> node21;
+    tree_node<2, 2> node22;
+    tree_node<1, 0> node10;
+    node11_t node11;
+    tree_node<1, 2> node12;
+    leaf00_t* leaves[] = {
+        static_cast<leaf00_t*>(static_cast<node11_t*>(static_cast<node20_t*>(&root))),
+        static_cast<leaf00_t*>(static_cast<node11_t*>(&node21)),
+        static_cast<leaf00_t*>(static_cast<node11_t*>(&node22)),
+        static_cast<leaf00_t*>(&node10),
+        static_cast<leaf00_t*>(&node11),
+        static_cast<leaf00_t*>(&node12)
+    };
+    std::vector<leaf00_t*> many;
+    for (std::size_t i = 0; i < 50; ++i) {
+        many.insert(many.end(), leaves, leaves + 6);
+    }
+    std::vector<leaf02_t*> siblings;
+    runtime_cast_filter<leaf02_t>(many.begin(), many.end(), std::back_inserter(siblings));
+    BOOST_TEST_EQ(siblings.size(), many.size());
+    for (std::size_t i = 0; i < many.size(); ++i) {
+        BOOST_TEST_EQ(siblings[i], runtime_pointer_cast<leaf02_t>(many[i]));
+    }
+}
+
 int main() {
-    no_base();
-    single_derived();
-    multiple_base();
-    virtual_base();
-    pointer_interface();
-    reference_interface();
-    const_pointer_interface();
-    const_reference_interface();
-    diamond_non_virtual();
-    boost_shared_ptr();
-    std_shared_ptr();
-    register_runtime_class();
+    // Second pass checks the results that were memoized by the first one
+    // if BOOST_TYPE_INDEX_RUNTIME_CAST_MEMOIZE is defined
+    for (int i = 0; i < 2; ++i) {
+        no_base();
+        single_derived();
+        multiple_base();
+        virtual_base();
+        pointer_interface();
+        reference_interface();
+        try_reference_interface();
+        const_pointer_interface();
+        const_reference_interface();
+        diamond_non_virtual();
+        boost_shared_ptr();
+        std_shared_ptr();
+        register_runtime_class();
+        cached_casts();
+        deep_hierarchy();
+        runtime_visit_dispatch();
+        runtime_is_queries();
+        final_target();
+        filter_range();
+    }
     return boost::report_errors();
 }
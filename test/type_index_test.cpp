@@ -9,6 +9,7 @@
 
 #include <boost/core/lightweight_test.hpp>
 #include <boost/type_index.hpp>
+#include <boost/type_index/pretty_name_cstr.hpp>
 
 namespace my_namespace1 {
     class my_class{};
@@ -224,6 +225,56 @@ void type_index_stream_operator_via_stringstream_testing()
     }
 }
 
+template <class T>
+void test_pretty_name_cstr_templ() {
+    using namespace boost::typeindex;
+    const char* const name = pretty_name_cstr(type_id<T>());
+    BOOST_TEST_EQ(std::string(name), type_id<T>().pretty_name());
+    BOOST_TEST_EQ(pretty_name_cstr(type_id<T>()), name);
+    BOOST_TEST_EQ(pretty_name_cstr(type_id_with_cvr<const T>()), type_id_with_cvr<const T>().pretty_name());
+}
+
+template <int N>
+struct with_index {};
+
+void pretty_name_cstr_matches_pretty_name()
+{
+    test_pretty_name_cstr_templ<int>();
+    test_pretty_name_cstr_templ<double>();
+    test_pretty_name_cstr_templ<my_namespace1::my_class>();
+    test_pretty_name_cstr_templ<my_namespace2::my_class>();
+
+    // Enough types for the cache to grow
+    test_pretty_name_cstr_templ<with_index<0> >();
+    test_pretty_name_cstr_templ<with_index<1> >();
+    test_pretty_name_cstr_templ<with_index<2> >();
+    test_pretty_name_cstr_templ<with_index<3> >();
+    test_pretty_name_cstr_templ<with_index<4> >();
+    test_pretty_name_cstr_templ<with_index<5> >();
+    test_pretty_name_cstr_templ<with_index<6> >();
+    test_pretty_name_cstr_templ<with_index<7> >();
+    test_pretty_name_cstr_templ<with_index<8> >();
+    test_pretty_name_cstr_templ<with_index<9> >();
+
+    BOOST_TEST_EQ(boost::typeindex::pretty_name_cstr(boost::typeindex::type_id<int>()), std::string("int"));
+
+    // Names are found by the contents of the raw name, not by its address
+    boost::typeindex::detail::pretty_name_cache cache;
+    const std::string raw_name = "raw";
+    const char* const name = cache.insert(raw_name.c_str(), "pretty", 6);
+    BOOST_TEST_EQ(std::string(name), "pretty");
+    const std::string raw_name_copy = raw_name;
+    BOOST_TEST_EQ(cache.find(raw_name_copy.c_str()), name);
+    BOOST_TEST(!cache.find("other"));
+
+    // Fast path requires both the identity and the address of the raw name to match
+    int identity = 0;
+    BOOST_TEST(!cache.find(&identity, raw_name.c_str()));
+    cache.remember(&identity, raw_name.c_str(), name);
+    BOOST_TEST_EQ(cache.find(&identity, raw_name.c_str()), name);
+    BOOST_TEST(!cache.find(&identity, raw_name_copy.c_str()));
+}
+
 void type_index_stripping_cvr_test()
 {
     using namespace boost::typeindex;
@@ -391,6 +442,7 @@ int main() {
     type_id_storing_modifiers();
     type_id_storing_modifiers_vs_nonstoring();
     type_index_stream_operator_via_stringstream_testing();
+    pretty_name_cstr_matches_pretty_name();
     type_index_stripping_cvr_test();
     type_index_user_defined_class_test();
 
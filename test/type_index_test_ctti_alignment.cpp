@@ -7,11 +7,39 @@
 
 #include <boost/type_index/ctti_type_index.hpp>
 
+#include <cstddef>
+#include <type_traits>
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+template <unsigned int N>
+void check_name_storage() {
+    using storage_t = boost::typeindex::detail::ctti_name_storage<N>;
+
+    static_assert(
+        std::is_standard_layout<storage_t>::value,
+        "boost::typeindex::detail::ctti_name_storage must be a standard-layout class."
+    );
+    static_assert(
+        offsetof(storage_t, data_) == sizeof(boost::typeindex::detail::ctti_name_header),
+        "Name characters must immediately follow boost::typeindex::detail::ctti_name_header. "
+        "It is unsafe to get the header from a pointer to the name."
+    );
+}
+#endif
+
 int main() {
     static_assert(
         alignof(boost::typeindex::detail::ctti_data) == alignof(char),
         "Alignments of boost::typeindex::detail::ctti_data and char differ. "
         "It is unsafe to reinterpret_cast between them."
     );
-}
 
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+    check_name_storage<1>();
+    check_name_storage<2>();
+    check_name_storage<7>();
+    check_name_storage<8>();
+    check_name_storage<9>();
+    check_name_storage<1000>();
+#endif
+}
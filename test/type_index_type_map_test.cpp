@@ -0,0 +1,140 @@
+//
+// Copyright 2012-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index/type_map.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <memory>
+#include <string>
+
+namespace my_namespace {
+    template <int I> struct my_class {};
+}
+
+using boost::typeindex::type_id;
+using boost::typeindex::type_map;
+
+void basic_operations() {
+    type_map<std::string> m;
+    BOOST_TEST(m.empty());
+    BOOST_TEST(m.find(type_id<int>()) == m.end());
+    BOOST_TEST_EQ(m.erase(type_id<int>()), 0u);
+
+    BOOST_TEST(m.emplace(type_id<int>(), "int").second);
+    BOOST_TEST(!m.emplace(type_id<const int&>(), "other int").second);
+    BOOST_TEST(m.insert(std::make_pair(type_id<short>(), std::string("short"))).second);
+    m[type_id<std::string>()] = "string";
+
+    BOOST_TEST_EQ(m.size(), 3u);
+    BOOST_TEST_EQ(m.at(type_id<int>()), "int");
+    BOOST_TEST_EQ(m[type_id<short>()], "short");
+    BOOST_TEST_EQ(m.find(type_id<std::string>())->second, "string");
+    BOOST_TEST(m.contains(type_id<int>()));
+    BOOST_TEST(!m.contains(type_id<long>()));
+    BOOST_TEST(!m.contains(boost::typeindex::type_id_with_cvr<const int>()));
+    BOOST_TEST_THROWS(m.at(type_id<long>()), std::out_of_range);
+
+    BOOST_TEST(!m.insert_or_assign(type_id<int>(), "integer").second);
+    BOOST_TEST_EQ(m.at(type_id<int>()), "integer");
+
+    BOOST_TEST_EQ(m.erase(type_id<short>()), 1u);
+    BOOST_TEST_EQ(m.size(), 2u);
+    BOOST_TEST(m.find(type_id<short>()) == m.end());
+
+    std::size_t count = 0;
+    for (const auto& v : m) {
+        BOOST_TEST(v.first == type_id<int>() || v.first == type_id<std::string>());
+        ++count;
+    }
+    BOOST_TEST_EQ(count, 2u);
+
+    const type_map<std::string> copy = m;
+    BOOST_TEST_EQ(copy.size(), 2u);
+    BOOST_TEST_EQ(copy.at(type_id<std::string>()), "string");
+
+    type_map<std::string> moved = std::move(m);
+    BOOST_TEST_EQ(moved.size(), 2u);
+    BOOST_TEST(m.empty());
+
+    moved.clear();
+    BOOST_TEST(moved.empty());
+    BOOST_TEST(moved.begin() == moved.end());
+}
+
+template <int I>
+void insert_one(type_map<int>& m) {
+    BOOST_TEST(m.emplace(type_id<my_namespace::my_class<I> >(), I).second);
+}
+
+template <int I>
+void check_one(const type_map<int>& m, bool erased) {
+    const auto it = m.find(type_id<my_namespace::my_class<I> >());
+    if (erased && I % 3 == 0) {
+        BOOST_TEST(it == m.end());
+    } else {
+        BOOST_TEST(it != m.end() && it->second == I);
+    }
+}
+
+template <int... I>
+void many_types_impl(type_map<int>& m) {
+    const int inserted[] = { (insert_one<I>(m), 0)... };
+    BOOST_TEST_EQ(m.size(), sizeof(inserted) / sizeof(int));
+    const int checked[] = { (check_one<I>(m, false), 0)... };
+    (void)checked;
+
+    const int erased[] = { (I % 3 == 0 ? m.erase(type_id<my_namespace::my_class<I> >()) : 0, 0)... };
+    (void)erased;
+    const int checked_after_erase[] = { (check_one<I>(m, true), 0)... };
+    (void)checked_after_erase;
+
+    std::size_t count = 0;
+    for (auto it = m.begin(); it != m.end(); ++it) {
+        BOOST_TEST(it->second % 3 != 0);
+        ++count;
+    }
+    BOOST_TEST_EQ(count, m.size());
+
+    // Erasing through iterators
+    for (auto it = m.begin(); it != m.end();) {
+        it = (it->second % 2 ? m.erase(it) : std::next(it));
+    }
+    for (const auto& v : m) {
+        BOOST_TEST_EQ(v.second % 2, 0);
+    }
+}
+
+void many_types() {
+    type_map<int> m;
+    many_types_impl<
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+        40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+        60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79
+    >(m);
+    BOOST_TEST_GE(m.capacity(), 64u);
+}
+
+void move_only_values() {
+    type_map<std::unique_ptr<int> > m;
+    m.reserve(100);
+    const std::size_t capacity = m.capacity();
+    m.emplace(type_id<int>(), new int(42));
+    m[type_id<short>()].reset(new int(7));
+    BOOST_TEST_EQ(*m.at(type_id<int>()), 42);
+    BOOST_TEST_EQ(*m.at(type_id<short>()), 7);
+    BOOST_TEST_EQ(m.capacity(), capacity);
+}
+
+int main() {
+    basic_operations();
+    many_types();
+    move_only_values();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,185 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures insertions and lookups of boost::typeindex::type_map, boost::unordered_flat_map<type_index, V>
+// and std::unordered_map<std::type_index, V> for 10 to 100k types and prints the results as JSON to stdout.
+// Without RTTI std::unordered_map<type_index, V, boost::hash<type_index>> is measured instead of
+// std::unordered_map<std::type_index, V>.
+//
+// Usage: type_map_benchmark [lookups]
+//
+// By default 10240 types are generated. Define TYPE_MAP_BENCHMARK_ROWS=1563 to measure 100k types,
+// compilation takes several minutes in that case.
+
+#include <boost/type_index/type_map.hpp>
+#include <boost/config.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/version.hpp>
+
+#if BOOST_VERSION >= 108100
+#include <boost/unordered/unordered_flat_map.hpp>
+#else
+#include <boost/unordered_map.hpp>
+#endif
+
+#include "type_map_benchmark_types.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef TYPE_MAP_BENCHMARK_ROWS
+#define TYPE_MAP_BENCHMARK_ROWS 160
+#endif
+
+struct result {
+    std::string container;
+    std::size_t size;
+    double insert_ns;
+    double hit_ns;
+    double miss_ns;
+};
+
+std::vector<result> results;
+std::size_t lookups = 1000000;
+std::size_t sink = 0;
+
+// Best time of several runs, in nanoseconds per operation
+template <class F>
+double measure(std::size_t operations, F f) {
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        sink += f();
+        const auto finish = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / operations;
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+template <class Map, class Key>
+std::size_t find_all(const Map& map, const std::vector<Key>& queries) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < lookups; ++i) {
+        found += (map.find(queries[i % queries.size()]) != map.end());
+    }
+    return found;
+}
+
+// Inserts the first `size` keys and looks up the inserted and the following keys
+template <class Map, class Key>
+void bench(const char* container, const std::vector<Key>& all, std::size_t size) {
+    const std::vector<Key> keys(all.begin(), all.begin() + size);
+
+    benchmark_random random(size);
+    std::vector<Key> hits;
+    std::vector<Key> misses;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        hits.push_back(keys[random(size)]);
+        if (all.size() > size) {
+            misses.push_back(all[size + random(all.size() - size)]);
+        }
+    }
+
+    const double insert_ns = measure(size, [&keys]() {
+        Map map;
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            map.emplace(keys[i], static_cast<int>(i));
+        }
+        return map.size();
+    });
+
+    Map map;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        map.emplace(keys[i], static_cast<int>(i));
+    }
+    if (find_all(map, hits) != lookups || (!misses.empty() && find_all(map, misses) != 0)) {
+        std::cerr << "Unexpected lookup results for " << container << '\n';
+        std::exit(1);
+    }
+
+    const double hit_ns = measure(lookups, [&map, &hits]() { return find_all(map, hits); });
+    const double miss_ns = (misses.empty() ? -1 : measure(lookups, [&map, &misses]() { return find_all(map, misses); }));
+    results.push_back(result{container, size, insert_ns, hit_ns, miss_ns});
+}
+
+const char* mode() {
+#if defined(BOOST_NO_RTTI)
+    return "no_rtti";
+#elif defined(BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY)
+    return "rtti_ctti";
+#else
+    return "rtti";
+#endif
+}
+
+void print_json(std::size_t types) {
+    std::cout << "{\n"
+              << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+              << "  \"compiler\": \"" << BOOST_COMPILER << "\",\n"
+              << "  \"mode\": \"" << mode() << "\",\n"
+              << "  \"type_index\": \"" << boost::typeindex::type_id<boost::typeindex::type_index>().pretty_name() << "\",\n"
+              << "  \"types\": " << types << ",\n"
+              << "  \"lookups\": " << lookups << ",\n"
+              << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        std::cout << "    {\"container\": \"" << r.container
+                  << "\", \"size\": " << r.size
+                  << ", \"insert_ns\": " << r.insert_ns
+                  << ", \"hit_ns\": " << r.hit_ns
+                  << ", \"miss_ns\": ";
+        if (r.miss_ns < 0) {
+            std::cout << "null";
+        } else {
+            std::cout << r.miss_ns;
+        }
+        std::cout << (i + 1 == results.size() ? "}\n" : "},\n");
+    }
+    std::cout << "  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        lookups = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+        if (!lookups) {
+            std::cerr << "Usage: " << argv[0] << " [lookups]\n";
+            return 1;
+        }
+    }
+
+    using boost::typeindex::type_index;
+    const std::vector<type_index> types = make_benchmark_types<boost_type_keys, TYPE_MAP_BENCHMARK_ROWS>();
+#ifndef BOOST_NO_RTTI
+    const std::vector<std::type_index> std_types = make_benchmark_types<std_type_keys, TYPE_MAP_BENCHMARK_ROWS>();
+#endif
+
+    for (std::size_t size = 10; size <= types.size(); size *= 10) {
+        bench<boost::typeindex::type_map<int> >("boost::typeindex::type_map", types, size);
+#if BOOST_VERSION >= 108100
+        bench<boost::unordered_flat_map<type_index, int> >("boost::unordered_flat_map", types, size);
+#else
+        bench<boost::unordered_map<type_index, int> >("boost::unordered_map", types, size);
+#endif
+#ifndef BOOST_NO_RTTI
+        bench<std::unordered_map<std::type_index, int> >("std::unordered_map<std::type_index>", std_types, size);
+#else
+        bench<std::unordered_map<type_index, int, boost::hash<type_index> > >("std::unordered_map", types, size);
+#endif
+    }
+
+    print_json(types.size());
+    return 0;
+}
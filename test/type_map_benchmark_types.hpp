@@ -0,0 +1,115 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_TYPE_INDEX_TESTS_TYPE_MAP_BENCHMARK_TYPES_HPP
+#define BOOST_TYPE_INDEX_TESTS_TYPE_MAP_BENCHMARK_TYPES_HPP
+
+// Many distinct types for the benchmarks of the containers with type keys
+
+#include <boost/type_index.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#ifndef BOOST_NO_RTTI
+#include <typeindex>
+#endif
+
+namespace benchmark_namespace { namespace messages {
+
+template <std::size_t Row, std::size_t Column>
+struct message {};
+
+}} // namespace benchmark_namespace::messages
+
+constexpr std::size_t benchmark_types_per_row = 64;
+
+template <std::size_t... I>
+struct benchmark_indexes {};
+
+template <class Left, class Right>
+struct benchmark_concat_indexes;
+
+template <std::size_t... I, std::size_t... J>
+struct benchmark_concat_indexes<benchmark_indexes<I...>, benchmark_indexes<J...> > {
+    using type = benchmark_indexes<I..., (sizeof...(I) + J)...>;
+};
+
+// Logarithmic recursion depth, so that thousands of rows do not hit the template depth limit
+template <std::size_t N>
+struct benchmark_make_indexes: benchmark_concat_indexes<
+    typename benchmark_make_indexes<N / 2>::type,
+    typename benchmark_make_indexes<N - N / 2>::type
+> {};
+
+template <>
+struct benchmark_make_indexes<0> {
+    using type = benchmark_indexes<>;
+};
+
+template <>
+struct benchmark_make_indexes<1> {
+    using type = benchmark_indexes<0>;
+};
+
+// Key makers for make_benchmark_types()
+struct boost_type_keys {
+    using key_type = boost::typeindex::type_index;
+
+    template <class T>
+    static key_type make() noexcept { return boost::typeindex::type_id<T>(); }
+};
+
+#ifndef BOOST_NO_RTTI
+struct std_type_keys {
+    using key_type = std::type_index;
+
+    template <class T>
+    static key_type make() noexcept { return typeid(T); }
+};
+#endif
+
+template <class Keys, std::size_t Row, std::size_t... Column>
+void append_benchmark_row(std::vector<typename Keys::key_type>& types, benchmark_indexes<Column...>) {
+    const typename Keys::key_type row[] = {Keys::template make<benchmark_namespace::messages::message<Row, Column> >()...};
+    types.insert(types.end(), row, row + sizeof...(Column));
+}
+
+template <class Keys, std::size_t... Row>
+void append_benchmark_rows(std::vector<typename Keys::key_type>& types, benchmark_indexes<Row...>) {
+    const int expand[] = {(
+        append_benchmark_row<Keys, Row>(types, typename benchmark_make_indexes<benchmark_types_per_row>::type()), 0
+    )...};
+    (void)expand;
+}
+
+// Returns Rows * benchmark_types_per_row keys of distinct types
+template <class Keys, std::size_t Rows>
+std::vector<typename Keys::key_type> make_benchmark_types() {
+    std::vector<typename Keys::key_type> types;
+    types.reserve(Rows * benchmark_types_per_row);
+    append_benchmark_rows<Keys>(types, typename benchmark_make_indexes<Rows>::type());
+    return types;
+}
+
+// Deterministic pseudo random numbers, the same for all the runs and platforms
+class benchmark_random {
+public:
+    explicit benchmark_random(std::size_t seed) noexcept
+        : state_(seed * 2 + 1)
+    {}
+
+    std::size_t operator()(std::size_t bound) noexcept {
+        state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::size_t>((state_ >> 33) % bound);
+    }
+
+private:
+    unsigned long long state_;
+};
+
+#endif // BOOST_TYPE_INDEX_TESTS_TYPE_MAP_BENCHMARK_TYPES_HPP
@@ -0,0 +1,243 @@
+//
+// Copyright 2013-2026 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Converts names returned by std::type_info::name(), one per line, into human readable names in the same way
+// as boost::typeindex::stl_type_index::pretty_name() does, including the removal of the
+// boost::typeindex::detail::cvr_saver<...> wrapper. Names that can not be demangled are written as is.
+//
+// Usage: demangle_type_names [-j threads] [file]
+//
+// Reads the standard input if there is no file or if the file is "-". On POSIX systems files are memory mapped.
+// Input is processed in chunks, identical names of a chunk are demangled once, in parallel by `threads` threads.
+
+#include <boost/type_index/pretty_name_batch.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#   define BOOST_TYPE_INDEX_TOOLS_HAS_MMAP
+#endif
+
+namespace {
+
+constexpr std::size_t chunk_size = 64 * 1024 * 1024;
+
+class line_demangler {
+public:
+    explicit line_demangler(std::size_t threads)
+        : threads_(threads)
+    {}
+
+    // Writes the names for the lines from [begin, end) to the standard output. The last line may have no '\n'.
+    bool write_lines(const char* begin, const char* end) {
+        if (begin == end) {
+            return true;
+        }
+
+        lines_.assign(begin, end);
+        if (lines_.back() != '\n') {
+            lines_.push_back('\n');
+        }
+
+        raw_names_.clear();
+        std::size_t line_begin = 0;
+        for (std::size_t i = 0; i < lines_.size(); ++i) {
+            if (lines_[i] == '\n') {
+                lines_[i] = '\0';
+                if (i > line_begin && lines_[i - 1] == '\r') {
+                    lines_[i - 1] = '\0';
+                }
+                raw_names_.push_back(lines_.data() + line_begin);
+                line_begin = i + 1;
+            }
+        }
+
+        const boost::typeindex::pretty_name_batch names(raw_names_.data(), raw_names_.size(), threads_);
+        output_.clear();
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            output_.append(names[i], names.length(i));
+            output_.push_back('\n');
+        }
+
+        return std::fwrite(output_.data(), 1, output_.size(), stdout) == output_.size();
+    }
+
+private:
+    const std::size_t threads_;
+    std::string lines_;
+    std::vector<const char*> raw_names_;
+    std::string output_;
+};
+
+bool demangle_stream(std::FILE* input, line_demangler& demangler) {
+    std::vector<char> buffer(chunk_size);
+    std::size_t size = 0;
+    for (;;) {
+        const std::size_t read = std::fread(buffer.data() + size, 1, buffer.size() - size, input);
+        size += read;
+        if (!read) {
+            return !std::ferror(input) && demangler.write_lines(buffer.data(), buffer.data() + size);
+        }
+
+        std::size_t complete = size;
+        while (complete && buffer[complete - 1] != '\n') {
+            --complete;
+        }
+
+        if (!complete) {
+            if (size == buffer.size()) {
+                // Line is longer than the buffer
+                buffer.resize(buffer.size() * 2);
+            }
+            continue;
+        }
+
+        if (!demangler.write_lines(buffer.data(), buffer.data() + complete)) {
+            return false;
+        }
+        std::memmove(buffer.data(), buffer.data() + complete, size - complete);
+        size -= complete;
+    }
+}
+
+#ifdef BOOST_TYPE_INDEX_TOOLS_HAS_MMAP
+
+// Returns false with errno set if the file could not be processed. Sets `mapped` to false if the file
+// could not be memory mapped, for example if it is a pipe.
+bool demangle_mapped_file(int fd, line_demangler& demangler, bool& mapped) {
+    mapped = false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        return false;
+    }
+    if (!S_ISREG(info.st_mode)) {
+        return true;
+    }
+
+    const std::size_t size = static_cast<std::size_t>(info.st_size);
+    if (!size) {
+        mapped = true;
+        return true;
+    }
+
+    void* const data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        return true;
+    }
+    mapped = true;
+    ::madvise(data, size, MADV_SEQUENTIAL);
+
+    const char* const begin = static_cast<const char*>(data);
+    const char* const end = begin + size;
+    bool result = true;
+    for (const char* chunk = begin; result && chunk != end; ) {
+        const char* chunk_end = end;
+        if (static_cast<std::size_t>(end - chunk) > chunk_size) {
+            const void* const line_end = std::memchr(chunk + chunk_size, '\n', static_cast<std::size_t>(end - chunk - chunk_size));
+            chunk_end = (line_end ? static_cast<const char*>(line_end) + 1 : end);
+        }
+
+        result = demangler.write_lines(chunk, chunk_end);
+        chunk = chunk_end;
+    }
+
+    ::munmap(data, size);
+    return result;
+}
+
+#endif
+
+bool demangle_file(const char* path, line_demangler& demangler) {
+#ifdef BOOST_TYPE_INDEX_TOOLS_HAS_MMAP
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool mapped = false;
+    bool result = demangle_mapped_file(fd, demangler, mapped);
+    if (result && !mapped) {
+        if (std::FILE* const input = ::fdopen(fd, "rb")) {
+            result = demangle_stream(input, demangler);
+            std::fclose(input);
+            return result;
+        }
+        result = false;
+    }
+
+    const int error = errno;
+    ::close(fd);
+    errno = error;
+    return result;
+#else
+    std::FILE* const input = std::fopen(path, "rb");
+    if (!input) {
+        return false;
+    }
+
+    const bool result = demangle_stream(input, demangler);
+    std::fclose(input);
+    return result;
+#endif
+}
+
+int usage(const char* program) {
+    std::fprintf(stderr, "Usage: %s [-j threads] [file]\n", program);
+    return 2;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    std::size_t threads = std::thread::hardware_concurrency();
+    const char* path = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "-j")) {
+            if (++i == argc) {
+                return usage(argv[0]);
+            }
+            threads = static_cast<std::size_t>(std::strtoul(argv[i], nullptr, 10));
+            if (!threads) {
+                return usage(argv[0]);
+            }
+        } else if (!std::strcmp(argv[i], "-h") || !std::strcmp(argv[i], "--help") || path) {
+            return usage(argv[0]);
+        } else {
+            path = argv[i];
+        }
+    }
+
+    line_demangler demangler(threads ? threads : 1);
+    errno = 0;
+    const bool result = (path && std::strcmp(path, "-")
+        ? demangle_file(path, demangler)
+        : demangle_stream(stdin, demangler)
+    );
+
+    if (!result) {
+        std::fprintf(stderr, "%s: %s: %s\n", argv[0], (path ? path : "-"), std::strerror(errno ? errno : EIO));
+        return 1;
+    }
+    if (std::fflush(stdout) != 0) {
+        std::fprintf(stderr, "%s: %s\n", argv[0], std::strerror(errno));
+        return 1;
+    }
+    return 0;
+}